@@ -0,0 +1,137 @@
+#include <bigint23/bigint.hpp>
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+namespace {
+    using uint128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned>;
+    using uint256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+    using int256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Signed>;
+    using uint1024 = bigint::bigint<bigint::BitWidth{1024}, bigint::Signedness::Unsigned>;
+
+    template<typename T>
+    std::vector<T> random_values(std::uint64_t const seed, std::size_t const count) {
+        auto engine = std::mt19937_64{seed};
+        auto result = std::vector<T>(count);
+        for (auto &value: result) {
+            for (auto i = 0uz; i < sizeof(T) / sizeof(std::uint64_t); ++i) {
+                value = (value << 64) | T{engine()};
+            }
+        }
+        return result;
+    }
+
+    // The element loops the batch functions replace, for comparison.
+    template<typename T>
+    void add_loop_bench(benchmark::State &state) {
+        auto const count = static_cast<std::size_t>(state.range(0));
+        auto const lhs = random_values<T>(1, count);
+        auto const rhs = random_values<T>(2, count);
+        auto out = std::vector<T>(count);
+        for (auto _: state) {
+            for (auto i = 0uz; i < count; ++i) {
+                out[i] = lhs[i] + rhs[i];
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template<typename T>
+    void add_n_bench(benchmark::State &state) {
+        auto const count = static_cast<std::size_t>(state.range(0));
+        auto const lhs = random_values<T>(1, count);
+        auto const rhs = random_values<T>(2, count);
+        auto out = std::vector<T>(count);
+        for (auto _: state) {
+            bigint::add_n(std::span{out}, lhs, rhs);
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template<typename T>
+    void mul_n_bench(benchmark::State &state) {
+        auto const count = static_cast<std::size_t>(state.range(0));
+        auto const lhs = random_values<T>(1, count);
+        auto const rhs = random_values<T>(2, count);
+        auto out = std::vector<T>(count);
+        for (auto _: state) {
+            bigint::mul_n(std::span{out}, lhs, rhs);
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template<typename T>
+    void compare_loop_bench(benchmark::State &state) {
+        auto const count = static_cast<std::size_t>(state.range(0));
+        auto const lhs = random_values<T>(1, count);
+        auto rhs = lhs;
+        rhs[count / 2] += 1;
+        auto out = std::vector<std::strong_ordering>(count, std::strong_ordering::equal);
+        for (auto _: state) {
+            for (auto i = 0uz; i < count; ++i) {
+                out[i] = lhs[i] <=> rhs[i];
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template<typename T>
+    void compare_n_bench(benchmark::State &state) {
+        auto const count = static_cast<std::size_t>(state.range(0));
+        auto const lhs = random_values<T>(1, count);
+        auto rhs = lhs;
+        rhs[count / 2] += 1;
+        auto out = std::vector<std::strong_ordering>(count, std::strong_ordering::equal);
+        for (auto _: state) {
+            bigint::compare_n(std::span{out}, std::span<T const>{lhs}, rhs);
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template<typename T>
+    void sum_loop_bench(benchmark::State &state) {
+        auto const values = random_values<T>(1, static_cast<std::size_t>(state.range(0)));
+        for (auto _: state) {
+            auto sum = T{};
+            for (auto const &value: values) {
+                sum += value;
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template<typename T>
+    void sum_reduce_bench(benchmark::State &state) {
+        auto const values = random_values<T>(1, static_cast<std::size_t>(state.range(0)));
+        for (auto _: state) {
+            benchmark::DoNotOptimize(bigint::sum_reduce(std::span<T const>{values}));
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+#define BIGINT_BATCH_BENCHMARK(function)                      \
+    BENCHMARK_TEMPLATE(function, uint128)->Arg(4096);         \
+    BENCHMARK_TEMPLATE(function, uint256)->Arg(4096);         \
+    BENCHMARK_TEMPLATE(function, uint256)->Arg(1 << 20);      \
+    BENCHMARK_TEMPLATE(function, int256)->Arg(4096);          \
+    BENCHMARK_TEMPLATE(function, uint1024)->Arg(4096)
+
+BIGINT_BATCH_BENCHMARK(add_loop_bench);
+BIGINT_BATCH_BENCHMARK(add_n_bench);
+BIGINT_BATCH_BENCHMARK(mul_n_bench);
+BIGINT_BATCH_BENCHMARK(compare_loop_bench);
+BIGINT_BATCH_BENCHMARK(compare_n_bench);
+BIGINT_BATCH_BENCHMARK(sum_loop_bench);
+BIGINT_BATCH_BENCHMARK(sum_reduce_bench);
@@ -0,0 +1,89 @@
+#include <bigint23/dispatch.hpp>
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace {
+    using uint256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+    using uint1024 = bigint::bigint<bigint::BitWidth{1024}, bigint::Signedness::Unsigned>;
+    using int2048 = bigint::bigint<bigint::BitWidth{2048}, bigint::Signedness::Signed>;
+
+    template<typename T>
+    T random_value(std::uint64_t const seed) {
+        auto engine = std::mt19937_64{seed};
+        auto result = T{};
+        for (auto i = 0uz; i < sizeof(T) / sizeof(std::uint64_t); ++i) {
+            result = (result << 64) | T{engine()};
+        }
+        return result;
+    }
+
+    // The header-only operators and their runtime dispatched counterparts side by side.
+    template<typename T>
+    void header_add_bench(benchmark::State &state) {
+        auto const lhs = random_value<T>(1);
+        auto const rhs = random_value<T>(2);
+        for (auto _: state) {
+            benchmark::DoNotOptimize(lhs + rhs);
+        }
+    }
+
+    template<typename T>
+    void dispatch_add_bench(benchmark::State &state) {
+        auto const lhs = random_value<T>(1);
+        auto const rhs = random_value<T>(2);
+        state.SetLabel(std::string{bigint::dispatch::to_string(bigint::dispatch::selected().arithmetic)});
+        for (auto _: state) {
+            benchmark::DoNotOptimize(bigint::dispatch::add(lhs, rhs));
+        }
+    }
+
+    template<typename T>
+    void header_multiply_bench(benchmark::State &state) {
+        auto const lhs = random_value<T>(1);
+        auto const rhs = random_value<T>(2);
+        for (auto _: state) {
+            benchmark::DoNotOptimize(lhs * rhs);
+        }
+    }
+
+    template<typename T>
+    void dispatch_multiply_bench(benchmark::State &state) {
+        auto const lhs = random_value<T>(1);
+        auto const rhs = random_value<T>(2);
+        state.SetLabel(std::string{bigint::dispatch::to_string(bigint::dispatch::selected().arithmetic)});
+        for (auto _: state) {
+            benchmark::DoNotOptimize(bigint::dispatch::multiply(lhs, rhs));
+        }
+    }
+
+    template<typename T>
+    void header_wide_multiply_bench(benchmark::State &state) {
+        auto const lhs = random_value<T>(1);
+        auto const rhs = random_value<T>(2);
+        for (auto _: state) {
+            benchmark::DoNotOptimize(bigint::wide_multiply(lhs, rhs));
+        }
+    }
+
+    template<typename T>
+    void dispatch_wide_multiply_bench(benchmark::State &state) {
+        auto const lhs = random_value<T>(1);
+        auto const rhs = random_value<T>(2);
+        state.SetLabel(std::string{bigint::dispatch::to_string(bigint::dispatch::selected().arithmetic)});
+        for (auto _: state) {
+            benchmark::DoNotOptimize(bigint::dispatch::wide_multiply(lhs, rhs));
+        }
+    }
+}
+
+#define BIGINT_DISPATCH_BENCHMARK(function)       \
+    BENCHMARK_TEMPLATE(function, uint256);        \
+    BENCHMARK_TEMPLATE(function, uint1024);       \
+    BENCHMARK_TEMPLATE(function, int2048)
+
+BIGINT_DISPATCH_BENCHMARK(header_add_bench);
+BIGINT_DISPATCH_BENCHMARK(dispatch_add_bench);
+BIGINT_DISPATCH_BENCHMARK(header_multiply_bench);
+BIGINT_DISPATCH_BENCHMARK(dispatch_multiply_bench);
+BIGINT_DISPATCH_BENCHMARK(header_wide_multiply_bench);
+BIGINT_DISPATCH_BENCHMARK(dispatch_wide_multiply_bench);
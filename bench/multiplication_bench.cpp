@@ -0,0 +1,225 @@
+#include <bigint23/bigint.hpp>
+#include <benchmark/benchmark.h>
+#if defined(bigint_HAS_PARALLEL)
+#include <execution>
+#endif
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace {
+    using bigint::detail::limb;
+
+    template<std::size_t n>
+    std::array<limb, n> random_limbs(std::uint64_t const seed) {
+        auto engine = std::mt19937_64{seed};
+        auto result = std::array<limb, n>{};
+        for (auto &value: result) {
+            value = engine();
+        }
+        return result;
+    }
+
+    // Each algorithm is timed for one level at n limbs; sub-products use the configured thresholds,
+    // so the crossover is where a split level starts to beat the method below it.
+    template<std::size_t n>
+    void multiply_schoolbook_bench(benchmark::State &state) {
+        auto const lhs = random_limbs<n>(1);
+        auto const rhs = random_limbs<n>(2);
+        auto result = std::array<limb, 2 * n>{};
+        for (auto _: state) {
+            bigint::detail::multiply_schoolbook(lhs, rhs, result);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+    template<std::size_t n>
+    void multiply_karatsuba_bench(benchmark::State &state) {
+        auto const lhs = random_limbs<n>(1);
+        auto const rhs = random_limbs<n>(2);
+        auto result = std::array<limb, 2 * n>{};
+        for (auto _: state) {
+            bigint::detail::multiply_karatsuba(lhs, rhs, result);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+    template<std::size_t n>
+    void multiply_toom3_bench(benchmark::State &state) {
+        auto const lhs = random_limbs<n>(1);
+        auto const rhs = random_limbs<n>(2);
+        auto result = std::array<limb, 2 * n>{};
+        for (auto _: state) {
+            bigint::detail::multiply_toom3(lhs, rhs, result);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+    template<std::size_t n>
+    void multiply_ntt_bench(benchmark::State &state) {
+        auto const lhs = random_limbs<n>(1);
+        auto const rhs = random_limbs<n>(2);
+        auto result = std::array<limb, 2 * n>{};
+        for (auto _: state) {
+            bigint::detail::multiply_ntt(lhs, rhs, result, bigint::detail::sequential_fork{});
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+    template<std::size_t n>
+    std::string decimal_limbs(std::array<limb, n> const &value) {
+        auto text = std::string(20 * n, ' ');
+        auto const last = text.data() + text.size();
+        return {bigint::detail::format_decimal(value, last), last};
+    }
+
+    // Chunked decimal parsing against divide and conquer, which takes over above
+    // bigint_DECIMAL_PARSE_THRESHOLD limbs.
+    template<std::size_t n>
+    void parse_decimal_chunked_bench(benchmark::State &state) {
+        auto const text = decimal_limbs(random_limbs<n>(1));
+        auto result = std::array<limb, n>{};
+        for (auto _: state) {
+            benchmark::DoNotOptimize(bigint::detail::parse_decimal_chunked(text, result));
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+    template<std::size_t n>
+    void parse_decimal_bench(benchmark::State &state) {
+        auto const text = decimal_limbs(random_limbs<n>(1));
+        auto result = std::array<limb, n>{};
+        for (auto _: state) {
+            benchmark::DoNotOptimize(bigint::detail::parse_decimal(text, result));
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+    template<std::size_t bits>
+    void multiply_operator_bench(benchmark::State &state) {
+        using type = bigint::bigint<bigint::BitWidth{bits}, bigint::Signedness::Unsigned>;
+        auto const random_value = [](std::uint64_t const seed) {
+            auto engine = std::mt19937_64{seed};
+            auto result = type{};
+            for (auto i = 0uz; i < bits / bigint::detail::limb_bits; ++i) {
+                result = (result << bigint::detail::limb_bits) | type{engine()};
+            }
+            return result;
+        };
+        auto const lhs = random_value(1);
+        auto const rhs = random_value(2);
+        for (auto _: state) {
+            benchmark::DoNotOptimize(lhs * rhs);
+        }
+    }
+
+    template<std::size_t bits>
+    bigint::bigint<bigint::BitWidth{bits}, bigint::Signedness::Unsigned> random_operand(std::uint64_t const seed) {
+        using type = bigint::bigint<bigint::BitWidth{bits}, bigint::Signedness::Unsigned>;
+        auto engine = std::mt19937_64{seed};
+        auto result = type{};
+        for (auto i = 0uz; i < bits / bigint::detail::limb_bits; ++i) {
+            result = (result << bigint::detail::limb_bits) | type{engine()};
+        }
+        return result;
+    }
+
+#if defined(bigint_HAS_PARALLEL)
+    // The execution policy overloads; compare par against seq to see what threading gains.
+    template<std::size_t bits, typename Policy>
+    void multiply_policy_bench(benchmark::State &state) {
+        auto const lhs = random_operand<bits>(1);
+        auto const rhs = random_operand<bits>(2);
+        for (auto _: state) {
+            benchmark::DoNotOptimize(bigint::wide_multiply(Policy{}, lhs, rhs));
+        }
+    }
+
+    template<std::size_t bits, typename Policy>
+    void print_dec_policy_bench(benchmark::State &state) {
+        auto const value = random_operand<bits>(1);
+        auto stream = std::ostringstream{};
+        for (auto _: state) {
+            stream.str({});
+            bigint::print_dec(Policy{}, stream, value);
+            benchmark::DoNotOptimize(stream);
+        }
+    }
+#endif
+}
+
+BENCHMARK_TEMPLATE(multiply_schoolbook_bench, 8);
+BENCHMARK_TEMPLATE(multiply_schoolbook_bench, 16);
+BENCHMARK_TEMPLATE(multiply_schoolbook_bench, 24);
+BENCHMARK_TEMPLATE(multiply_schoolbook_bench, 32);
+BENCHMARK_TEMPLATE(multiply_schoolbook_bench, 48);
+BENCHMARK_TEMPLATE(multiply_schoolbook_bench, 64);
+BENCHMARK_TEMPLATE(multiply_schoolbook_bench, 96);
+BENCHMARK_TEMPLATE(multiply_schoolbook_bench, 128);
+BENCHMARK_TEMPLATE(multiply_schoolbook_bench, 192);
+BENCHMARK_TEMPLATE(multiply_schoolbook_bench, 256);
+
+BENCHMARK_TEMPLATE(multiply_karatsuba_bench, 8);
+BENCHMARK_TEMPLATE(multiply_karatsuba_bench, 16);
+BENCHMARK_TEMPLATE(multiply_karatsuba_bench, 24);
+BENCHMARK_TEMPLATE(multiply_karatsuba_bench, 32);
+BENCHMARK_TEMPLATE(multiply_karatsuba_bench, 48);
+BENCHMARK_TEMPLATE(multiply_karatsuba_bench, 64);
+BENCHMARK_TEMPLATE(multiply_karatsuba_bench, 96);
+BENCHMARK_TEMPLATE(multiply_karatsuba_bench, 128);
+BENCHMARK_TEMPLATE(multiply_karatsuba_bench, 192);
+BENCHMARK_TEMPLATE(multiply_karatsuba_bench, 256);
+BENCHMARK_TEMPLATE(multiply_karatsuba_bench, 384);
+BENCHMARK_TEMPLATE(multiply_karatsuba_bench, 512);
+BENCHMARK_TEMPLATE(multiply_karatsuba_bench, 768);
+
+BENCHMARK_TEMPLATE(multiply_toom3_bench, 128);
+BENCHMARK_TEMPLATE(multiply_toom3_bench, 256);
+BENCHMARK_TEMPLATE(multiply_toom3_bench, 384);
+BENCHMARK_TEMPLATE(multiply_toom3_bench, 512);
+BENCHMARK_TEMPLATE(multiply_toom3_bench, 768);
+
+BENCHMARK_TEMPLATE(multiply_toom3_bench, 1024);
+BENCHMARK_TEMPLATE(multiply_toom3_bench, 1536);
+BENCHMARK_TEMPLATE(multiply_toom3_bench, 2048);
+BENCHMARK_TEMPLATE(multiply_toom3_bench, 4096);
+
+BENCHMARK_TEMPLATE(multiply_ntt_bench, 256);
+BENCHMARK_TEMPLATE(multiply_ntt_bench, 512);
+BENCHMARK_TEMPLATE(multiply_ntt_bench, 768);
+BENCHMARK_TEMPLATE(multiply_ntt_bench, 1024);
+BENCHMARK_TEMPLATE(multiply_ntt_bench, 1536);
+BENCHMARK_TEMPLATE(multiply_ntt_bench, 2048);
+BENCHMARK_TEMPLATE(multiply_ntt_bench, 4096);
+
+BENCHMARK_TEMPLATE(parse_decimal_chunked_bench, 256);
+BENCHMARK_TEMPLATE(parse_decimal_chunked_bench, 512);
+BENCHMARK_TEMPLATE(parse_decimal_chunked_bench, 1024);
+BENCHMARK_TEMPLATE(parse_decimal_chunked_bench, 2048);
+BENCHMARK_TEMPLATE(parse_decimal_chunked_bench, 4096);
+
+BENCHMARK_TEMPLATE(parse_decimal_bench, 256);
+BENCHMARK_TEMPLATE(parse_decimal_bench, 512);
+BENCHMARK_TEMPLATE(parse_decimal_bench, 1024);
+BENCHMARK_TEMPLATE(parse_decimal_bench, 2048);
+BENCHMARK_TEMPLATE(parse_decimal_bench, 4096);
+
+BENCHMARK_TEMPLATE(multiply_operator_bench, 1024);
+BENCHMARK_TEMPLATE(multiply_operator_bench, 2048);
+BENCHMARK_TEMPLATE(multiply_operator_bench, 4096);
+BENCHMARK_TEMPLATE(multiply_operator_bench, 8192);
+BENCHMARK_TEMPLATE(multiply_operator_bench, 65536);
+BENCHMARK_TEMPLATE(multiply_operator_bench, 131072);
+BENCHMARK_TEMPLATE(multiply_operator_bench, 262144);
+
+#if defined(bigint_HAS_PARALLEL)
+BENCHMARK_TEMPLATE(multiply_policy_bench, 16384, std::execution::sequenced_policy);
+BENCHMARK_TEMPLATE(multiply_policy_bench, 16384, std::execution::parallel_policy);
+BENCHMARK_TEMPLATE(multiply_policy_bench, 65536, std::execution::sequenced_policy);
+BENCHMARK_TEMPLATE(multiply_policy_bench, 65536, std::execution::parallel_policy);
+
+BENCHMARK_TEMPLATE(print_dec_policy_bench, 16384, std::execution::sequenced_policy);
+BENCHMARK_TEMPLATE(print_dec_policy_bench, 16384, std::execution::parallel_policy);
+BENCHMARK_TEMPLATE(print_dec_policy_bench, 65536, std::execution::sequenced_policy);
+BENCHMARK_TEMPLATE(print_dec_policy_bench, 65536, std::execution::parallel_policy);
+#endif
@@ -0,0 +1,285 @@
+#include <bigint23/expression.hpp>
+#include <benchmark/benchmark.h>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace {
+    using int128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed>;
+    using uint128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned>;
+    using int256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Signed>;
+    using uint256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+    using int512 = bigint::bigint<bigint::BitWidth{512}, bigint::Signedness::Signed>;
+    using uint512 = bigint::bigint<bigint::BitWidth{512}, bigint::Signedness::Unsigned>;
+    using int1024 = bigint::bigint<bigint::BitWidth{1024}, bigint::Signedness::Signed>;
+    using uint1024 = bigint::bigint<bigint::BitWidth{1024}, bigint::Signedness::Unsigned>;
+    using int4096 = bigint::bigint<bigint::BitWidth{4096}, bigint::Signedness::Signed>;
+    using uint4096 = bigint::bigint<bigint::BitWidth{4096}, bigint::Signedness::Unsigned>;
+
+    template<typename T>
+    constexpr std::size_t width() {
+        return sizeof(T) * CHAR_BIT;
+    }
+
+    // A positive value with random bits below bit used - 1.
+    template<typename T>
+    T random_value(std::uint64_t const seed, std::size_t const used) {
+        using unsigned_type = bigint::bigint<bigint::BitWidth{width<T>()}, bigint::Signedness::Unsigned>;
+        auto engine = std::mt19937_64{seed};
+        auto result = unsigned_type{};
+        for (auto i = 0uz; i < used; i += bigint::detail::limb_bits) {
+            result = (result << bigint::detail::limb_bits) | unsigned_type{engine()};
+        }
+        return T{result >> 1};
+    }
+
+    template<typename T>
+    std::string decimal_string(T const &value) {
+        auto stream = std::ostringstream{};
+        bigint::print_dec(stream, value);
+        return stream.str();
+    }
+
+    template<typename T>
+    void construct_integer_bench(benchmark::State &state) {
+        auto value = std::uint64_t{0x0123456789abcdef};
+        for (auto _: state) {
+            benchmark::DoNotOptimize(T{value});
+            ++value;
+        }
+    }
+
+    template<typename T>
+    void construct_string_bench(benchmark::State &state) {
+        auto const text = decimal_string(random_value<T>(1, width<T>()));
+        for (auto _: state) {
+            benchmark::DoNotOptimize(T{text});
+        }
+    }
+
+    template<typename T>
+    void construct_hex_string_bench(benchmark::State &state) {
+        auto stream = std::ostringstream{};
+        bigint::print_hex(stream << "0x", random_value<T>(1, width<T>()), false);
+        auto const text = stream.str();
+        for (auto _: state) {
+            benchmark::DoNotOptimize(T{text});
+        }
+    }
+
+    template<typename T>
+    void add_bench(benchmark::State &state) {
+        auto const lhs = random_value<T>(1, width<T>());
+        auto const rhs = random_value<T>(2, width<T>());
+        for (auto _: state) {
+            benchmark::DoNotOptimize(lhs + rhs);
+        }
+    }
+
+    template<typename T>
+    void subtract_bench(benchmark::State &state) {
+        auto const lhs = random_value<T>(1, width<T>());
+        auto const rhs = random_value<T>(2, width<T>());
+        for (auto _: state) {
+            benchmark::DoNotOptimize(lhs - rhs);
+        }
+    }
+
+    template<typename T>
+    void multiply_bench(benchmark::State &state) {
+        auto const lhs = random_value<T>(1, width<T>());
+        auto const rhs = random_value<T>(2, width<T>());
+        for (auto _: state) {
+            benchmark::DoNotOptimize(lhs * rhs);
+        }
+    }
+
+    // a * b + c * d - e with the operators and as one expression template; b and d are two limbs
+    // wide, so the products go row by row into the accumulator.
+    template<typename T>
+    void multiply_add_bench(benchmark::State &state) {
+        auto const a = random_value<T>(1, width<T>());
+        auto const b = random_value<T>(2, 2);
+        auto const c = random_value<T>(3, width<T>());
+        auto const d = random_value<T>(4, 2);
+        auto const e = random_value<T>(5, width<T>());
+        for (auto _: state) {
+            benchmark::DoNotOptimize(a * b + c * d - e);
+        }
+    }
+
+    template<typename T>
+    void lazy_multiply_add_bench(benchmark::State &state) {
+        using bigint::expression::lazy;
+        auto const a = random_value<T>(1, width<T>());
+        auto const b = random_value<T>(2, 2);
+        auto const c = random_value<T>(3, width<T>());
+        auto const d = random_value<T>(4, 2);
+        auto const e = random_value<T>(5, width<T>());
+        for (auto _: state) {
+            benchmark::DoNotOptimize(T{lazy(a) * b + lazy(c) * d - e});
+        }
+    }
+
+    template<typename T>
+    void divide_bench(benchmark::State &state) {
+        auto const lhs = random_value<T>(1, width<T>());
+        auto const rhs = random_value<T>(2, width<T>() / 2);
+        for (auto _: state) {
+            benchmark::DoNotOptimize(lhs / rhs);
+        }
+    }
+
+    template<typename T>
+    void modulo_bench(benchmark::State &state) {
+        auto const lhs = random_value<T>(1, width<T>());
+        auto const rhs = random_value<T>(2, width<T>() / 2);
+        for (auto _: state) {
+            benchmark::DoNotOptimize(lhs % rhs);
+        }
+    }
+
+    // Built-in operands go through the single limb paths.
+    template<typename T>
+    void multiply_integral_bench(benchmark::State &state) {
+        auto const lhs = random_value<T>(1, width<T>());
+        auto rhs = 1'000'000'007;
+        benchmark::DoNotOptimize(rhs);
+        for (auto _: state) {
+            benchmark::DoNotOptimize(lhs * rhs + 1);
+        }
+    }
+
+    template<typename T>
+    void divide_integral_bench(benchmark::State &state) {
+        auto const lhs = random_value<T>(1, width<T>());
+        auto rhs = 1'000'000'007;
+        benchmark::DoNotOptimize(rhs);
+        for (auto _: state) {
+            benchmark::DoNotOptimize(lhs / rhs);
+        }
+    }
+
+    template<typename T>
+    void shift_left_bench(benchmark::State &state) {
+        auto const value = random_value<T>(1, width<T>());
+        for (auto _: state) {
+            benchmark::DoNotOptimize(value << 67);
+        }
+    }
+
+    template<typename T>
+    void shift_right_bench(benchmark::State &state) {
+        auto const value = random_value<T>(1, width<T>());
+        for (auto _: state) {
+            benchmark::DoNotOptimize(value >> 67);
+        }
+    }
+
+    // A single-bit shift by a count the compiler cannot see, as in bit-serial loops.
+    template<typename T>
+    void shift_one_bench(benchmark::State &state) {
+        auto value = random_value<T>(1, width<T>());
+        auto shift = std::size_t{1};
+        for (auto _: state) {
+            benchmark::DoNotOptimize(shift);
+            value <<= shift;
+            value >>= shift;
+            benchmark::DoNotOptimize(value);
+        }
+    }
+
+    template<typename T>
+    void compare_bench(benchmark::State &state) {
+        auto const lhs = random_value<T>(1, width<T>());
+        auto const rhs = lhs + 1;
+        for (auto _: state) {
+            benchmark::DoNotOptimize(lhs < rhs);
+            benchmark::DoNotOptimize(lhs == rhs);
+        }
+    }
+
+    template<typename T>
+    void print_dec_bench(benchmark::State &state) {
+        auto const value = random_value<T>(1, width<T>());
+        auto stream = std::ostringstream{};
+        for (auto _: state) {
+            stream.str({});
+            bigint::print_dec(stream, value);
+            benchmark::DoNotOptimize(stream);
+        }
+    }
+
+    template<typename T>
+    void print_hex_bench(benchmark::State &state) {
+        auto const value = random_value<T>(1, width<T>());
+        auto stream = std::ostringstream{};
+        for (auto _: state) {
+            stream.str({});
+            bigint::print_hex(stream, value, false);
+            benchmark::DoNotOptimize(stream);
+        }
+    }
+
+    template<typename T>
+    void stream_extract_bench(benchmark::State &state) {
+        auto const text = decimal_string(random_value<T>(1, width<T>()));
+        auto stream = std::istringstream{};
+        auto value = T{};
+        for (auto _: state) {
+            stream.clear();
+            stream.str(text);
+            stream >> value;
+            benchmark::DoNotOptimize(value);
+        }
+    }
+
+    template<typename T, bigint::PowMode mode>
+    void pow_mod_bench(benchmark::State &state) {
+        auto const modulus = random_value<T>(1, width<T>()) | 1;
+        auto const base = random_value<T>(2, width<T>());
+        auto const exponent = random_value<T>(3, width<T>());
+        for (auto _: state) {
+            benchmark::DoNotOptimize(pow_mod(base, exponent, modulus, mode));
+        }
+    }
+}
+
+#define BIGINT_BENCHMARK(function)                \
+    BENCHMARK_TEMPLATE(function, int128);         \
+    BENCHMARK_TEMPLATE(function, uint128);        \
+    BENCHMARK_TEMPLATE(function, int256);         \
+    BENCHMARK_TEMPLATE(function, uint256);        \
+    BENCHMARK_TEMPLATE(function, int512);         \
+    BENCHMARK_TEMPLATE(function, uint512);        \
+    BENCHMARK_TEMPLATE(function, int1024);        \
+    BENCHMARK_TEMPLATE(function, uint1024);       \
+    BENCHMARK_TEMPLATE(function, int4096);        \
+    BENCHMARK_TEMPLATE(function, uint4096)
+
+BIGINT_BENCHMARK(construct_integer_bench);
+BIGINT_BENCHMARK(construct_string_bench);
+BIGINT_BENCHMARK(construct_hex_string_bench);
+BIGINT_BENCHMARK(add_bench);
+BIGINT_BENCHMARK(subtract_bench);
+BIGINT_BENCHMARK(multiply_bench);
+BIGINT_BENCHMARK(multiply_add_bench);
+BIGINT_BENCHMARK(lazy_multiply_add_bench);
+BIGINT_BENCHMARK(divide_bench);
+BIGINT_BENCHMARK(modulo_bench);
+BIGINT_BENCHMARK(multiply_integral_bench);
+BIGINT_BENCHMARK(divide_integral_bench);
+BIGINT_BENCHMARK(shift_left_bench);
+BIGINT_BENCHMARK(shift_right_bench);
+BIGINT_BENCHMARK(shift_one_bench);
+BIGINT_BENCHMARK(compare_bench);
+BIGINT_BENCHMARK(print_dec_bench);
+BIGINT_BENCHMARK(print_hex_bench);
+BIGINT_BENCHMARK(stream_extract_bench);
+
+BENCHMARK_TEMPLATE(pow_mod_bench, uint256, bigint::PowMode::SlidingWindow);
+BENCHMARK_TEMPLATE(pow_mod_bench, uint256, bigint::PowMode::MontgomeryLadder);
+BENCHMARK_TEMPLATE(pow_mod_bench, uint1024, bigint::PowMode::SlidingWindow);
+BENCHMARK_TEMPLATE(pow_mod_bench, uint1024, bigint::PowMode::MontgomeryLadder);
+BENCHMARK_TEMPLATE(pow_mod_bench, uint4096, bigint::PowMode::SlidingWindow);
+BENCHMARK_TEMPLATE(pow_mod_bench, uint4096, bigint::PowMode::MontgomeryLadder);
@@ -7,20 +7,82 @@
 #include <algorithm>
 #include <array>
 #include <bit>
+#include <charconv>
 #include <climits>
 #include <compare>
 #include <cstddef>
 #include <cstdint>
+#if __has_include(<format>)
+#include <format>
+#endif
 #ifndef bigint_DISABLE_IO
 #include <iostream>
 #endif
+#include <limits>
+#include <locale>
 #include <memory>
 #include <ranges>
 #include <regex>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <tuple>
 #include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#define bigint_HAS_INTRIN_ADDCARRY
+#elif defined(__x86_64__)
+#include <immintrin.h>
+#define bigint_HAS_INTRIN_ADDCARRY
+#endif
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_addcll) && __has_builtin(__builtin_subcll)
+#define bigint_HAS_BUILTIN_ADDC
+#endif
+#endif
+
+// Vector kernels for the batch operations. They are compiled with target attributes and picked at
+// runtime, so the rest of the header still builds for the baseline architecture.
+#if !defined(bigint_DISABLE_SIMD) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define bigint_HAS_BATCH_SIMD
+#endif
+
+// The execution policy overloads of multiply, wide_multiply and print_dec fork work onto std::async
+// threads. They are opt-in: define bigint_ENABLE_PARALLEL to get them. <execution> makes libstdc++
+// depend on TBB when it is installed and std::async needs threads, so programs that use them have
+// to link both.
+#if defined(bigint_ENABLE_PARALLEL) && __has_include(<execution>) && __has_include(<future>)
+#include <atomic>
+#include <execution>
+#include <future>
+#include <thread>
+#define bigint_HAS_PARALLEL
+#endif
+
+#ifndef bigint_PARALLEL_THRESHOLD
+#define bigint_PARALLEL_THRESHOLD 256
+#endif
+
+#ifndef bigint_KARATSUBA_THRESHOLD
+#define bigint_KARATSUBA_THRESHOLD 32
+#endif
+
+#ifndef bigint_TOOM3_THRESHOLD
+#define bigint_TOOM3_THRESHOLD 640
+#endif
+
+#ifndef bigint_NTT_THRESHOLD
+#define bigint_NTT_THRESHOLD 1024
+#endif
+
+#ifndef bigint_DECIMAL_PARSE_THRESHOLD
+#define bigint_DECIMAL_PARSE_THRESHOLD 256
+#endif
 
 namespace bigint {
 
@@ -31,1101 +93,4055 @@ namespace bigint {
         Unsigned
     };
 
-    template<BitWidth bits, Signedness signedness>
-    class bigint final {
-    private:
-        static_assert(std::to_underlying(bits) % CHAR_BIT == 0, "bits must be a multiple of CHAR_BIT");
-        std::array<std::uint8_t, std::to_underlying(bits) / CHAR_BIT> data_{};
+    namespace detail {
+        using limb = std::uint64_t;
 
-    public:
-        [[nodiscard]] constexpr bigint() = default;
+        inline constexpr std::size_t limb_bits = sizeof(limb) * CHAR_BIT;
 
-        template<std::integral T>
-        [[nodiscard]] constexpr bigint(T const data) {
-            static_assert(std::to_underlying(bits) / CHAR_BIT >= sizeof(T),
-                          "Can't assign values with a larger bit count than the target type.");
+#if defined(__SIZEOF_INT128__)
+        __extension__ using double_limb = unsigned __int128;
+#endif
 
-            auto fill = std::uint8_t{0};
-            if constexpr (std::is_signed_v<T>) {
-                fill = (data < 0 ? 0xFF : 0);
+        // The carry helpers use the compiler's add-with-carry primitives at runtime and a portable
+        // implementation during constant evaluation. carry and borrow are always 0 or 1.
+        [[nodiscard]] constexpr limb add_with_carry(limb const a, limb const b, limb &carry) {
+            if !consteval {
+#if defined(bigint_HAS_BUILTIN_ADDC)
+                auto carry_out = 0ull;
+                auto const result = limb{__builtin_addcll(a, b, carry, &carry_out)};
+                carry = carry_out;
+                return result;
+#elif defined(bigint_HAS_INTRIN_ADDCARRY)
+                auto result = 0ull;
+                carry = _addcarry_u64(static_cast<unsigned char>(carry), a, b, &result);
+                return result;
+#elif defined(__SIZEOF_INT128__)
+                auto const sum = double_limb{static_cast<double_limb>(a) + b + carry};
+                carry = static_cast<limb>(sum >> limb_bits);
+                return static_cast<limb>(sum);
+#endif
             }
-            data_.fill(fill);
+            auto const sum = limb{a + b};
+            auto const result = limb{sum + carry};
+            carry = static_cast<limb>((sum < a) | (result < sum));
+            return result;
+        }
 
-            if constexpr (std::endian::native == std::endian::little) {
-                std::array<std::uint8_t, sizeof(T)> temp = std::bit_cast<std::array<std::uint8_t, sizeof(T)>>(data);
-                std::copy_n(temp.data(), temp.size(), data_.begin());
-            } else {
-                std::array<std::uint8_t, sizeof(T)> temp = std::bit_cast<std::array<std::uint8_t, sizeof(T)>>(data);
-                std::copy_n(temp.data(), temp.size(), data_.end() - sizeof(T));
+        [[nodiscard]] constexpr limb sub_with_borrow(limb const a, limb const b, limb &borrow) {
+            if !consteval {
+#if defined(bigint_HAS_BUILTIN_ADDC)
+                auto borrow_out = 0ull;
+                auto const result = limb{__builtin_subcll(a, b, borrow, &borrow_out)};
+                borrow = borrow_out;
+                return result;
+#elif defined(bigint_HAS_INTRIN_ADDCARRY)
+                auto result = 0ull;
+                borrow = _subborrow_u64(static_cast<unsigned char>(borrow), a, b, &result);
+                return result;
+#elif defined(__SIZEOF_INT128__)
+                auto const diff = double_limb{static_cast<double_limb>(a) - b - borrow};
+                borrow = static_cast<limb>(diff >> limb_bits) & 1;
+                return static_cast<limb>(diff);
+#endif
             }
+            auto const diff = limb{a - b};
+            auto const result = limb{diff - borrow};
+            borrow = static_cast<limb>((a < b) | (diff < borrow));
+            return result;
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        [[nodiscard]] constexpr bigint(bigint<other_bits, other_signedness> const &other) {
-            static_assert(bits >= other_bits, "Can't assign values with a larger bit count than the target type.");
+        // Returns the low limb of a * b and stores the high limb in high.
+        [[nodiscard]] constexpr limb multiply_wide(limb const a, limb const b, limb &high) {
+#if defined(__SIZEOF_INT128__)
+            auto const product = double_limb{static_cast<double_limb>(a) * b};
+            high = static_cast<limb>(product >> limb_bits);
+            return static_cast<limb>(product);
+#else
+#if defined(_MSC_VER) && defined(_M_X64)
+            if !consteval {
+                return _umul128(a, b, &high);
+            }
+#endif
+            constexpr auto half_bits = limb_bits / 2;
+            constexpr auto half_mask = limb{(limb{1} << half_bits) - 1};
+            auto const a_lo = limb{a & half_mask};
+            auto const a_hi = limb{a >> half_bits};
+            auto const b_lo = limb{b & half_mask};
+            auto const b_hi = limb{b >> half_bits};
+            auto const lo_lo = limb{a_lo * b_lo};
+            auto const lo_hi = limb{a_lo * b_hi};
+            auto const hi_lo = limb{a_hi * b_lo};
+            auto const hi_hi = limb{a_hi * b_hi};
+            auto const middle = limb{(lo_lo >> half_bits) + (lo_hi & half_mask) + (hi_lo & half_mask)};
+            high = hi_hi + (lo_hi >> half_bits) + (hi_lo >> half_bits) + (middle >> half_bits);
+            return (middle << half_bits) | (lo_lo & half_mask);
+#endif
+        }
 
-            auto fill = std::uint8_t{0};
-            if constexpr (other_signedness == Signedness::Signed) {
-                fill = other < std::int8_t{0} ? 0xFF : 0;
+        template<std::size_t n>
+        constexpr void negate(std::array<limb, n> &value) {
+            auto borrow = limb{0};
+            for (auto &current: value) {
+                current = sub_with_borrow(0, current, borrow);
             }
-            data_.fill(fill);
+        }
 
-            if constexpr (std::endian::native == std::endian::little) {
-                for (auto const i: std::views::iota(0uz, other.data_.size())) {
-                    data_[i] = other.data_[i];
-                }
-            } else {
-                for (auto const i: std::views::iota(0uz, other.data_.size())) {
-                    data_[data_.size() - i - 1] = other.data_[other.data_.size() - i - 1];
-                }
+        // The high limb of high:low shifted left by less than limb_bits, and the low limb of high:low
+        // shifted right, as shld and shrd compute them. Splitting the opposite shift in two keeps a
+        // shift of zero defined without a branch.
+        [[nodiscard]] constexpr limb funnel_shift_left(limb const high, limb const low, std::size_t const shift) {
+            return (high << shift) | ((low >> 1) >> (limb_bits - 1 - shift));
+        }
+
+        [[nodiscard]] constexpr limb funnel_shift_right(limb const high, limb const low, std::size_t const shift) {
+            return (low >> shift) | ((high << 1) << (limb_bits - 1 - shift));
+        }
+
+        // Logical shifts of the whole array by less than its width, moving whole limbs first and then
+        // combining neighbouring limbs for the remaining bits.
+        template<std::size_t n>
+        constexpr void shift_left(std::array<limb, n> &value, std::size_t const shift) {
+            auto const limb_shift = shift / limb_bits;
+            auto const bit_shift = shift % limb_bits;
+            for (auto const i: std::views::reverse(std::views::iota(limb_shift + 1, n))) {
+                value[i] = funnel_shift_left(value[i - limb_shift], value[i - limb_shift - 1], bit_shift);
             }
+            value[limb_shift] = value[0] << bit_shift;
+            std::fill_n(value.begin(), limb_shift, limb{0});
         }
 
-        [[nodiscard]] constexpr bigint(std::string_view const str) {
-            if (str.length() > 2 and str[0] == '0') {
-                switch (str[1]) {
-                    case 'x':
-                        init_from_string_base(str.substr(2), 16);
-                        break;
-                    case 'b':
-                        init_from_string_base(str.substr(2), 2);
-                        break;
-                    default:
-                        init_from_string_base(str.substr(1), 8);
+        template<std::size_t n>
+        constexpr void shift_right(std::array<limb, n> &value, std::size_t const shift) {
+            auto const limb_shift = shift / limb_bits;
+            auto const bit_shift = shift % limb_bits;
+            auto const last = n - 1 - limb_shift;
+            for (auto const i: std::views::iota(0uz, last)) {
+                value[i] = funnel_shift_right(value[i + limb_shift + 1], value[i + limb_shift], bit_shift);
+            }
+            value[last] = value[n - 1] >> bit_shift;
+            std::fill(value.begin() + static_cast<std::ptrdiff_t>(last + 1), value.end(), limb{0});
+        }
+
+        // Divides the two limb value high:low by divisor and stores the remainder. high must be
+        // less than divisor so that the quotient fits into a single limb.
+        [[nodiscard]] constexpr limb divide_wide(limb const high, limb const low, limb const divisor, limb &remainder) {
+            if !consteval {
+#if defined(__GNUC__) && defined(__x86_64__)
+                auto quotient = limb{0};
+                __asm__("divq %4" : "=a"(quotient), "=d"(remainder) : "a"(low), "d"(high), "rm"(divisor));
+                return quotient;
+#elif defined(_MSC_VER) && defined(_M_X64)
+                return _udiv128(high, low, divisor, &remainder);
+#elif defined(__SIZEOF_INT128__)
+                auto const dividend = double_limb{(static_cast<double_limb>(high) << limb_bits) | low};
+                remainder = static_cast<limb>(dividend % divisor);
+                return static_cast<limb>(dividend / divisor);
+#endif
+            }
+
+            // Two rounds of half limb schoolbook division on the normalized divisor.
+            constexpr auto half_bits = limb_bits / 2;
+            constexpr auto half_base = limb{1} << half_bits;
+            constexpr auto half_mask = limb{half_base - 1};
+
+            auto const shift = std::countl_zero(divisor);
+            auto const normalized = limb{divisor << shift};
+            auto const divisor_high = limb{normalized >> half_bits};
+            auto const divisor_low = limb{normalized & half_mask};
+            auto const upper = shift == 0 ? high : limb{(high << shift) | (low >> (limb_bits - shift))};
+            auto const lower = limb{low << shift};
+
+            auto const estimate = [&](limb const top, limb const next) {
+                auto digit = limb{top / divisor_high};
+                auto rest = limb{top - digit * divisor_high};
+                while (digit >= half_base or digit * divisor_low > ((rest << half_bits) | next)) {
+                    --digit;
+                    rest += divisor_high;
+                    if (rest >= half_base) {
                         break;
-                }
-            } else {
-                if (str[0] == '-') {
-                    if constexpr (signedness == Signedness::Unsigned) {
-                        throw std::runtime_error("Cannot initialize an unsigned bigint23 with a negative value.");
-                    } else {
-                        init_from_string_base(str.substr(1), 10);
-                        *this = -*this;
                     }
-                } else {
-                    init_from_string_base(str, 10);
                 }
+                return digit;
+            };
+
+            auto const quotient_high = estimate(upper, lower >> half_bits);
+            auto const middle = limb{(upper << half_bits) + (lower >> half_bits) - quotient_high * normalized};
+            auto const quotient_low = estimate(middle, lower & half_mask);
+            remainder = ((middle << half_bits) + (lower & half_mask) - quotient_low * normalized) >> shift;
+            return (quotient_high << half_bits) | quotient_low;
+        }
+
+        template<std::size_t n>
+        [[nodiscard]] constexpr std::size_t significant_limbs(std::array<limb, n> const &value) {
+            auto count = n;
+            while (count > 0 and value[count - 1] == 0) {
+                --count;
             }
+            return count;
         }
 
-        template<std::size_t N>
-        [[nodiscard]] constexpr bigint(char const (&data)[N]) : bigint{std::string_view{data, N - 1}} {
+        // The number of bits up to and including the highest set one.
+        template<std::size_t n>
+        [[nodiscard]] constexpr std::size_t significant_bits(std::array<limb, n> const &value) {
+            auto const size = significant_limbs(value);
+            return size == 0 ? 0 : (size - 1) * limb_bits + static_cast<std::size_t>(std::bit_width(value[size - 1]));
         }
 
-        [[nodiscard]] constexpr bigint(std::string const &str) : bigint{std::string_view{str}} {
+        template<std::size_t n>
+        [[nodiscard]] constexpr std::strong_ordering compare(std::array<limb, n> const &lhs,
+                                                             std::array<limb, n> const &rhs) {
+            for (auto const i: std::views::reverse(std::views::iota(0uz, n))) {
+                if (lhs[i] != rhs[i]) {
+                    return lhs[i] <=> rhs[i];
+                }
+            }
+            return std::strong_ordering::equal;
         }
 
-        template<std::integral T>
-        bigint constexpr &operator=(T const rhs) {
-            this->~bigint();
-            new(this) bigint(rhs);
-            return *this;
+        // Divides value in place by a single limb and returns the remainder.
+        template<std::size_t n>
+        constexpr limb divide_in_place(std::array<limb, n> &value, std::size_t const size, limb const divisor) {
+            auto rest = limb{0};
+            for (auto const i: std::views::reverse(std::views::iota(0uz, size))) {
+                value[i] = divide_wide(rest, value[i], divisor, rest);
+            }
+            return rest;
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        bigint constexpr &operator=(bigint<other_bits, other_signedness> const &rhs) {
-            if (this != std::addressof(rhs)) {
-                this->~bigint();
-                new(this) bigint(rhs);
+        // A divisor shifted left until its top bit is set, together with the reciprocal
+        // floor((2^128 - 1) / divisor) - 2^64 of the shifted value. With it a two limb by one limb
+        // division takes two multiplications instead of a divide instruction (Möller and Granlund,
+        // "Improved division by invariant integers").
+        struct limb_reciprocal {
+            limb divisor;
+            limb inverse;
+            int shift;
+        };
+
+        [[nodiscard]] constexpr limb_reciprocal make_reciprocal(limb const divisor) {
+            auto const shift = std::countl_zero(divisor);
+            auto const normalized = limb{divisor << shift};
+            auto remainder = limb{0};
+            return {normalized, divide_wide(~normalized, ~limb{0}, normalized, remainder), shift};
+        }
+
+        // Divides high:low by the shifted divisor of reciprocal; high must be less than it.
+        [[nodiscard]] constexpr limb divide_wide(limb const high, limb const low, limb_reciprocal const &reciprocal,
+                                                 limb &remainder) {
+            auto quotient = limb{0};
+            auto fraction = multiply_wide(reciprocal.inverse, high, quotient);
+            auto carry = limb{0};
+            fraction = add_with_carry(fraction, low, carry);
+            quotient = add_with_carry(quotient, high + 1, carry);
+            auto rest = limb{low - quotient * reciprocal.divisor};
+            if (rest > fraction) {
+                --quotient;
+                rest += reciprocal.divisor;
             }
-            return *this;
+            if (rest >= reciprocal.divisor) {
+                ++quotient;
+                rest -= reciprocal.divisor;
+            }
+            remainder = rest;
+            return quotient;
         }
 
-        bigint constexpr &operator=(std::string_view const str) {
-            this->~bigint();
-            new(this) bigint(str);
-            return *this;
+        // divide_in_place for a divisor known at compile time. The dividend is shifted along with the
+        // divisor on the fly, which leaves the quotient unchanged and scales the remainder.
+        template<std::size_t n>
+        constexpr limb divide_in_place(std::array<limb, n> &value, std::size_t const size,
+                                       limb_reciprocal const &reciprocal) {
+            auto const shift = reciprocal.shift;
+            if (size == 0) {
+                return 0;
+            }
+            auto rest = shift == 0 ? limb{0} : limb{value[size - 1] >> (limb_bits - shift)};
+            for (auto const i: std::views::reverse(std::views::iota(0uz, size))) {
+                auto current = value[i];
+                if (shift != 0) {
+                    current = (current << shift) | (i > 0 ? value[i - 1] >> (limb_bits - shift) : 0);
+                }
+                value[i] = divide_wide(rest, current, reciprocal, rest);
+            }
+            return rest >> shift;
         }
 
-        template<std::size_t N>
-        bigint constexpr &operator=(char const (&rhs)[N]) {
-            this->~bigint();
-            new(this) bigint(rhs);
-            return *this;
+        // Dividend size in limbs from which a division by a runtime limb computes the reciprocal
+        // first. Setting it up costs a divide instruction and each step saves less than one, as the
+        // divide instructions of short dividends overlap with the surrounding code.
+        inline constexpr auto reciprocal_division_threshold = std::size_t{32};
+
+        // Operand sizes in limbs from which full products switch from schoolbook to Karatsuba, from
+        // Karatsuba to Toom-3 and from Toom-3 to the number-theoretic transform. The algorithm for a
+        // width is selected at compile time.
+        inline constexpr std::size_t karatsuba_threshold = bigint_KARATSUBA_THRESHOLD;
+        inline constexpr std::size_t toom3_threshold = bigint_TOOM3_THRESHOLD;
+        inline constexpr std::size_t ntt_threshold = bigint_NTT_THRESHOLD;
+        static_assert(karatsuba_threshold >= 2, "Karatsuba needs at least two limbs to split.");
+        static_assert(toom3_threshold >= 3, "Toom-3 needs at least three limbs to split.");
+
+        // Operand size in limbs from which the parallel overloads run subproblems on other threads.
+        inline constexpr std::size_t parallel_threshold = bigint_PARALLEL_THRESHOLD;
+
+        // Runs the independent subproblems of the multiplication and conversion algorithms, given the
+        // size in limbs of the problem they belong to. The default runs them one after the other.
+        struct sequential_fork {
+            template<typename... Tasks>
+            constexpr void operator()(std::size_t, Tasks const &... tasks) const {
+                (tasks(), ...);
+            }
+        };
+
+#if defined(bigint_HAS_PARALLEL)
+        // Fork-join over std::async: for problems of at least grain limbs every task but the last
+        // runs on a thread of its own while the calling thread runs the last one. A shared budget
+        // caps the extra threads at threads - 1; once it is used up, tasks run on the thread that
+        // forks them.
+        class parallel_fork {
+        public:
+            parallel_fork(std::size_t const grain, std::size_t const threads)
+                : grain_{grain}, budget_{static_cast<std::ptrdiff_t>(threads) - 1} {
+            }
+
+            template<typename... Tasks>
+            void operator()(std::size_t const size, Tasks const &... tasks) const {
+                if (size < grain_) {
+                    (tasks(), ...);
+                } else {
+                    run(tasks...);
+                }
+            }
+
+        private:
+            template<typename Task, typename... Rest>
+            void run(Task const &task, Rest const &... rest) const {
+                if constexpr (sizeof...(Rest) == 0) {
+                    task();
+                } else if (budget_.fetch_sub(1, std::memory_order_relaxed) > 0) {
+                    auto future = std::async(std::launch::async, task);
+                    run(rest...);
+                    future.get();
+                    budget_.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    budget_.fetch_add(1, std::memory_order_relaxed);
+                    task();
+                    run(rest...);
+                }
+            }
+
+            std::size_t grain_;
+            mutable std::atomic<std::ptrdiff_t> budget_;
+        };
+#endif
+
+        // Wrapping addition and subtraction of equally sized limb arrays.
+        template<std::size_t n>
+        constexpr void add_to(std::array<limb, n> &target, std::array<limb, n> const &value) {
+            auto carry = limb{0};
+            for (auto const i: std::views::iota(0uz, n)) {
+                target[i] = add_with_carry(target[i], value[i], carry);
+            }
         }
 
-        bigint constexpr &operator=(std::string const &rhs) {
-            this->~bigint();
-            new(this) bigint(rhs);
-            return *this;
+        template<std::size_t n>
+        constexpr void subtract_from(std::array<limb, n> &target, std::array<limb, n> const &value) {
+            auto borrow = limb{0};
+            for (auto const i: std::views::iota(0uz, n)) {
+                target[i] = sub_with_borrow(target[i], value[i], borrow);
+            }
         }
 
-        template<std::integral T>
-        [[nodiscard]] constexpr std::strong_ordering operator<=>(T const other) const {
-            static_assert(std::to_underlying(bits) / CHAR_BIT >= sizeof(T),
-                          "Can't compare values with a larger bit count than the target type.");
+        // Adds value to target starting at limb offset. Limbs and carries beyond target are dropped.
+        template<std::size_t n, std::size_t m>
+        constexpr void add_at(std::array<limb, n> &target, std::size_t const offset, std::array<limb, m> const &value) {
+            auto carry = limb{0};
+            auto i = offset;
+            for (; i < n and i - offset < m; ++i) {
+                target[i] = add_with_carry(target[i], value[i - offset], carry);
+            }
+            for (; i < n and carry != 0; ++i) {
+                target[i] = add_with_carry(target[i], 0, carry);
+            }
+        }
 
-            auto fill = std::uint8_t{0};
-            if constexpr (std::is_signed_v<T>) {
-                fill = (other < 0 ? 0xFF : 0);
+        // Zero extends or truncates value to m limbs, starting at limb offset.
+        template<std::size_t m, std::size_t n>
+        [[nodiscard]] constexpr std::array<limb, m> slice(std::array<limb, n> const &value, std::size_t const offset = 0) {
+            auto result = std::array<limb, m>{};
+            for (auto i = 0uz; i < m and offset + i < n; ++i) {
+                result[i] = value[offset + i];
             }
+            return result;
+        }
 
-            std::array<std::uint8_t, std::to_underlying(bits) / CHAR_BIT> extended{};
-            extended.fill(fill);
+        template<std::size_t n, typename Fork = sequential_fork>
+        constexpr void multiply_full(std::array<limb, n> const &lhs, std::array<limb, n> const &rhs,
+                                     std::array<limb, 2 * n> &result, Fork const &fork = {});
 
-            if constexpr (std::endian::native == std::endian::little) {
-                std::array<std::uint8_t, sizeof(T)> temp = std::bit_cast<std::array<std::uint8_t, sizeof(T)>>(other);
-                std::copy_n(temp.data(), temp.size(), extended.begin());
-                for (auto const i: std::views::reverse(std::views::iota(1uz, extended.size() + 1))) {
-                    if constexpr (std::is_signed_v<T>) {
-                        if (static_cast<std::int8_t>(data_[i - 1]) < static_cast<std::int8_t>(extended[i - 1])) {
-                            return std::strong_ordering::less;
-                        }
-                        if (static_cast<std::int8_t>(data_[i - 1]) > static_cast<std::int8_t>(extended[i - 1])) {
-                            return std::strong_ordering::greater;
-                        }
-                    } else {
-                        if (data_[i - 1] < extended[i - 1]) {
-                            return std::strong_ordering::less;
-                        }
-                        if (data_[i - 1] > extended[i - 1]) {
-                            return std::strong_ordering::greater;
-                        }
-                    }
+        // Schoolbook product of two little-endian limb arrays. The instruction sequence does not
+        // depend on the values, which the constant-time exponentiation relies on.
+        template<std::size_t n>
+        constexpr void multiply_schoolbook(std::array<limb, n> const &lhs, std::array<limb, n> const &rhs,
+                                           std::array<limb, 2 * n> &result) {
+            result.fill(0);
+            for (auto const i: std::views::iota(0uz, n)) {
+                auto carry = limb{0};
+                for (auto const j: std::views::iota(0uz, n)) {
+                    auto high = limb{0};
+                    auto low = multiply_wide(lhs[i], rhs[j], high);
+                    low += result[i + j];
+                    high += low < result[i + j];
+                    low += carry;
+                    high += low < carry;
+                    result[i + j] = low;
+                    carry = high;
                 }
+                result[i + n] = carry;
+            }
+        }
+
+        // Karatsuba: with x = x1 * B^h + x0 the middle coefficient a0 * b1 + a1 * b0 is computed as
+        // a0 * b0 + a1 * b1 - (a0 - a1) * (b0 - b1), three half size products instead of four.
+        template<std::size_t n, typename Fork = sequential_fork>
+        constexpr void multiply_karatsuba(std::array<limb, n> const &lhs, std::array<limb, n> const &rhs,
+                                          std::array<limb, 2 * n> &result, Fork const &fork = {}) {
+            constexpr auto h = (n + 1) / 2;
+            auto const a0 = slice<h>(lhs);
+            auto const a1 = slice<h>(lhs, h);
+            auto const b0 = slice<h>(rhs);
+            auto const b1 = slice<h>(rhs, h);
+
+            auto const a_negative = compare(a0, a1) < 0;
+            auto const b_negative = compare(b0, b1) < 0;
+            auto a_difference = a_negative ? a1 : a0;
+            auto b_difference = b_negative ? b1 : b0;
+            subtract_from(a_difference, a_negative ? a0 : a1);
+            subtract_from(b_difference, b_negative ? b0 : b1);
+
+            auto low = std::array<limb, 2 * h>{};
+            auto high = std::array<limb, 2 * h>{};
+            auto cross = std::array<limb, 2 * h>{};
+            fork(n,
+                 [&] { multiply_full(a0, b0, low, fork); },
+                 [&] { multiply_full(a1, b1, high, fork); },
+                 [&] { multiply_full(a_difference, b_difference, cross, fork); });
+
+            auto middle = slice<2 * h + 1>(low);
+            add_to(middle, slice<2 * h + 1>(high));
+            if (a_negative == b_negative) {
+                subtract_from(middle, slice<2 * h + 1>(cross));
             } else {
-                std::array<std::uint8_t, sizeof(T)> temp = std::bit_cast<std::array<std::uint8_t, sizeof(T)>>(other);
-                std::copy_n(temp.data(), temp.size(), extended.end() - sizeof(T));
-                for (auto const i: std::views::iota(0uz, extended.size())) {
-                    if constexpr (std::is_signed_v<T>) {
-                        if (static_cast<std::int8_t>(data_[i]) < static_cast<std::int8_t>(extended[i])) {
-                            return std::strong_ordering::less;
-                        }
-                        if (static_cast<std::int8_t>(data_[i]) > static_cast<std::int8_t>(extended[i])) {
-                            return std::strong_ordering::greater;
-                        }
-                    } else {
-                        if (data_[i] < extended[i]) {
-                            return std::strong_ordering::less;
-                        }
-                        if (data_[i] > extended[i]) {
-                            return std::strong_ordering::greater;
-                        }
-                    }
-                }
+                add_to(middle, slice<2 * h + 1>(cross));
             }
 
-            return std::strong_ordering::equal;
+            result.fill(0);
+            add_at(result, 0, low);
+            add_at(result, h, middle);
+            add_at(result, 2 * h, high);
         }
 
-        template<std::integral T>
-        [[nodiscard]] constexpr bool operator==(T const other) const {
-            static_assert(std::to_underlying(bits) / CHAR_BIT >= sizeof(T),
-                          "Can't compare values with a larger bit count than the target type.");
-            if constexpr (std::is_signed_v<T> and signedness == Signedness::Unsigned) {
-                if (other < 0) {
-                    return false;
+        // Toom-3 evaluates both operands split in three parts at 0, 1, -1, -2 and infinity, multiplies
+        // the five points recursively and interpolates with Bodrato's sequence. Point values are kept
+        // in two's complement.
+        template<std::size_t n, typename Fork = sequential_fork>
+        constexpr void multiply_toom3(std::array<limb, n> const &lhs, std::array<limb, n> const &rhs,
+                                      std::array<limb, 2 * n> &result, Fork const &fork = {}) {
+            constexpr auto k = (n + 2) / 3;
+            constexpr auto m = 2 * k + 2;
+            using point = std::array<limb, k + 1>;
+            using product = std::array<limb, m>;
+
+            auto const evaluate = [](std::array<limb, n> const &value) {
+                auto const p0 = slice<k + 1>(slice<k>(value));
+                auto const p1 = slice<k + 1>(slice<k>(value, k));
+                auto const p2 = slice<k + 1>(slice<k>(value, 2 * k));
+                auto points = std::array<point, 3>{p0, p0, p0};
+                add_to(points[0], p1);
+                add_to(points[0], p2);
+                subtract_from(points[1], p1);
+                add_to(points[1], p2);
+                auto twice_p1 = p1;
+                add_to(twice_p1, p1);
+                auto four_p2 = p2;
+                add_to(four_p2, p2);
+                add_to(four_p2, four_p2);
+                subtract_from(points[2], twice_p1);
+                add_to(points[2], four_p2);
+                return points;
+            };
+            auto const multiply_point = [&fork](point lhs_point, point rhs_point) {
+                auto const lhs_negative = (lhs_point[k] >> (limb_bits - 1)) != 0;
+                auto const rhs_negative = (rhs_point[k] >> (limb_bits - 1)) != 0;
+                if (lhs_negative) {
+                    negate(lhs_point);
+                }
+                if (rhs_negative) {
+                    negate(rhs_point);
                 }
+                auto value = product{};
+                multiply_full(lhs_point, rhs_point, value, fork);
+                if (lhs_negative != rhs_negative) {
+                    negate(value);
+                }
+                return value;
+            };
+            auto const shift_right = [](product &value) {
+                auto const sign = value[m - 1] & (limb{1} << (limb_bits - 1));
+                for (auto const i: std::views::iota(0uz, m - 1)) {
+                    value[i] = (value[i] >> 1) | (value[i + 1] << (limb_bits - 1));
+                }
+                value[m - 1] = (value[m - 1] >> 1) | sign;
+            };
+
+            auto const lhs_points = evaluate(lhs);
+            auto const rhs_points = evaluate(rhs);
+            auto low = std::array<limb, 2 * k>{};
+            auto high = std::array<limb, 2 * k>{};
+            auto r1 = product{};
+            auto r2 = product{};
+            auto r3 = product{};
+            fork(n,
+                 [&] { multiply_full(slice<k>(lhs), slice<k>(rhs), low, fork); },
+                 [&] { multiply_full(slice<k>(lhs, 2 * k), slice<k>(rhs, 2 * k), high, fork); },
+                 [&] { r1 = multiply_point(lhs_points[0], rhs_points[0]); },
+                 [&] { r2 = multiply_point(lhs_points[1], rhs_points[1]); },
+                 [&] { r3 = multiply_point(lhs_points[2], rhs_points[2]); });
+            auto r0 = slice<m>(low);
+            auto r4 = slice<m>(high);
+
+            // r3 = (r(-2) - r(1)) / 3, the division is exact.
+            subtract_from(r3, r1);
+            auto const r3_negative = (r3[m - 1] >> (limb_bits - 1)) != 0;
+            if (r3_negative) {
+                negate(r3);
             }
+            constexpr auto three = make_reciprocal(3);
+            divide_in_place(r3, m, three);
+            if (r3_negative) {
+                negate(r3);
+            }
+            // r1 = (r(1) - r(-1)) / 2
+            subtract_from(r1, r2);
+            shift_right(r1);
+            // r2 = r(-1) - r(0)
+            subtract_from(r2, r0);
+            // r3 = (r2 - r3) / 2 + 2 * r(inf)
+            auto difference = r2;
+            subtract_from(difference, r3);
+            shift_right(difference);
+            r3 = difference;
+            add_to(r3, r4);
+            add_to(r3, r4);
+            // r2 = r2 + r1 - r(inf)
+            add_to(r2, r1);
+            subtract_from(r2, r4);
+            // r1 = r1 - r3
+            subtract_from(r1, r3);
+
+            result.fill(0);
+            add_at(result, 0, low);
+            add_at(result, k, r1);
+            add_at(result, 2 * k, r2);
+            add_at(result, 3 * k, r3);
+            add_at(result, 4 * k, high);
+        }
 
-            auto fill = std::uint8_t{0};
-            if constexpr (std::is_signed_v<T>) {
-                fill = (other < 0 ? 0xFF : 0);
+        // A prime p = c * 2^k + 1 below 2^62 for the number-theoretic transform, with Montgomery
+        // arithmetic modulo p. Inputs to multiply may be any limb; everything else is kept in [0, p).
+        class ntt_prime {
+        public:
+            constexpr ntt_prime(limb const modulus, limb const generator)
+                : modulus_{modulus}, generator_{generator}, inverse_{negated_inverse(modulus)},
+                  r2_{power_of_two(2 * limb_bits, modulus)} {
             }
 
-            std::array<std::uint8_t, std::to_underlying(bits) / CHAR_BIT> extended{};
-            extended.fill(fill);
+            [[nodiscard]] constexpr limb modulus() const {
+                return modulus_;
+            }
 
-            if constexpr (std::endian::native == std::endian::little) {
-                std::array<std::uint8_t, sizeof(T)> temp = std::bit_cast<std::array<std::uint8_t, sizeof(T)>>(other);
-                std::copy_n(temp.data(), temp.size(), extended.begin());
-            } else {
-                std::array<std::uint8_t, sizeof(T)> temp = std::bit_cast<std::array<std::uint8_t, sizeof(T)>>(other);
-                std::copy_n(temp.data(), temp.size(), extended.begin() + (extended.size() - sizeof(T)));
+            [[nodiscard]] constexpr limb add(limb const a, limb const b) const {
+                auto const sum = a + b;
+                return sum >= modulus_ ? sum - modulus_ : sum;
             }
 
-            return extended == data_;
-        }
+            [[nodiscard]] constexpr limb subtract(limb const a, limb const b) const {
+                return a >= b ? a - b : a + modulus_ - b;
+            }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        [[nodiscard]] constexpr std::strong_ordering operator
-        <=>(bigint<other_bits, other_signedness> const &other) const {
-            static constexpr std::size_t lhs_size = std::to_underlying(bits) / CHAR_BIT;
-            static constexpr std::size_t rhs_size = std::to_underlying(other_bits) / CHAR_BIT;
-            static constexpr std::size_t max_size = (lhs_size > rhs_size ? lhs_size : rhs_size);
+            // a * b / 2^64 mod p. a * b + m * p stays below 2^128 because b < p < 2^62.
+            [[nodiscard]] constexpr limb multiply(limb const a, limb const b) const {
+                auto high = limb{0};
+                auto const low = multiply_wide(a, b, high);
+                auto reduce_high = limb{0};
+                std::ignore = multiply_wide(low * inverse_, modulus_, reduce_high);
+                auto const result = high + reduce_high + limb{low != 0};
+                return result >= modulus_ ? result - modulus_ : result;
+            }
 
-            std::array<std::uint8_t, max_size> lhs_extended{};
-            std::array<std::uint8_t, max_size> rhs_extended{};
+            // Converts a limb into Montgomery form.
+            [[nodiscard]] constexpr limb to_montgomery(limb const value) const {
+                return multiply(value, r2_);
+            }
 
-            auto lhs_fill = std::uint8_t{0};
-            if constexpr (signedness == Signedness::Signed) {
-                if constexpr (std::endian::native == std::endian::little) {
-                    if (data_[lhs_size - 1] & 0x80) {
-                        lhs_fill = 0xFF;
-                    }
-                } else {
-                    if (data_[0] & 0x80) {
-                        lhs_fill = 0xFF;
+            [[nodiscard]] constexpr limb power(limb base, limb exponent) const {
+                auto result = to_montgomery(1);
+                base = to_montgomery(base);
+                for (; exponent != 0; exponent >>= 1) {
+                    if ((exponent & 1) != 0) {
+                        result = multiply(result, base);
                     }
+                    base = multiply(base, base);
                 }
+                return multiply(result, 1);
             }
-            lhs_extended.fill(lhs_fill);
 
-            auto rhs_fill = std::uint8_t{0};
-            if constexpr (other_signedness == Signedness::Signed) {
-                if constexpr (std::endian::native == std::endian::little) {
-                    if (other.data_[rhs_size - 1] & 0x80) {
-                        rhs_fill = 0xFF;
-                    }
-                } else {
-                    if (other.data_[0] & 0x80) {
-                        rhs_fill = 0xFF;
-                    }
+            // A primitive root of unity of the given power-of-two order, in Montgomery form.
+            [[nodiscard]] constexpr limb root(std::size_t const order) const {
+                return to_montgomery(power(generator_, (modulus_ - 1) / order));
+            }
+
+        private:
+            [[nodiscard]] static constexpr limb negated_inverse(limb const modulus) {
+                auto inverse = modulus;
+                for (auto i = 0; i < 5; ++i) {
+                    inverse *= 2 - modulus * inverse;
                 }
+                return 0 - inverse;
             }
-            rhs_extended.fill(rhs_fill);
 
-            if constexpr (std::endian::native == std::endian::little) {
-                std::copy(data_.begin(), data_.end(), lhs_extended.begin());
-                std::copy(other.data_.begin(), other.data_.end(), rhs_extended.begin());
-            } else {
-                std::copy(data_.begin(), data_.end(), lhs_extended.begin() + (max_size - lhs_size));
-                std::copy(other.data_.begin(), other.data_.end(), rhs_extended.begin() + (max_size - rhs_size));
+            [[nodiscard]] static constexpr limb power_of_two(std::size_t const exponent, limb const modulus) {
+                auto result = limb{1};
+                for (auto i = 0uz; i < exponent; ++i) {
+                    result = result >= modulus - result ? result - (modulus - result) : 2 * result;
+                }
+                return result;
             }
 
-            if constexpr (std::endian::native == std::endian::little) {
-                for (auto const i: std::views::reverse(std::views::iota(0uz, max_size))) {
-                    std::strong_ordering value{std::strong_ordering::equal};
-                    if (spaceship_check_index<max_size, other_signedness>(lhs_extended, rhs_extended, i, value)) {
-                        return value;
+            limb modulus_;
+            limb generator_;
+            limb inverse_;
+            limb r2_;
+        };
+
+        // 29 * 2^57 + 1, 69 * 2^55 + 1 and 27 * 2^56 + 1. Their product exceeds 2^183, so every
+        // coefficient of a convolution of up to 2^55 limbs is recovered exactly by the CRT.
+        inline constexpr auto ntt_primes = std::array{
+            ntt_prime{4179340454199820289ull, 3},
+            ntt_prime{2485986994308513793ull, 5},
+            ntt_prime{1945555039024054273ull, 5},
+        };
+        static_assert(2 * ntt_primes[1].modulus() > ntt_primes[0].modulus() and
+                      3 * ntt_primes[2].modulus() > ntt_primes[0].modulus() and
+                      2 * ntt_primes[2].modulus() > ntt_primes[1].modulus(),
+                      "The CRT adds these multiples to stay non-negative.");
+
+        // In-place transforms of length values.size(), a power of two. The forward transform
+        // (decimation in frequency) leaves the values in bit-reversed order and the inverse
+        // transform (decimation in time) takes them in that order, so no permutation is needed.
+        // roots[j] holds w^j for j < length / 2, where w is a root of unity of order length.
+        constexpr void ntt_forward(std::vector<limb> &values, std::vector<limb> const &roots, ntt_prime const prime) {
+            auto const length = values.size();
+            for (auto half = length / 2; half >= 1; half /= 2) {
+                auto const stride = length / (2 * half);
+                for (auto start = 0uz; start < length; start += 2 * half) {
+                    for (auto const j: std::views::iota(0uz, half)) {
+                        auto const u = values[start + j];
+                        auto const v = values[start + j + half];
+                        values[start + j] = prime.add(u, v);
+                        values[start + j + half] = prime.multiply(prime.subtract(u, v), roots[j * stride]);
                     }
                 }
-            } else {
-                for (auto const i: std::views::iota(0u, max_size)) {
-                    std::strong_ordering value{std::strong_ordering::equal};
-                    if (spaceship_check_index<max_size, other_signedness>(lhs_extended, rhs_extended, i, value)) {
-                        return value;
+            }
+        }
+
+        constexpr void ntt_inverse(std::vector<limb> &values, std::vector<limb> const &roots, ntt_prime const prime) {
+            auto const length = values.size();
+            for (auto half = 1uz; half < length; half *= 2) {
+                auto const stride = length / (2 * half);
+                for (auto start = 0uz; start < length; start += 2 * half) {
+                    for (auto const j: std::views::iota(0uz, half)) {
+                        auto const u = values[start + j];
+                        auto const v = prime.multiply(values[start + j + half], roots[j * stride]);
+                        values[start + j] = prime.add(u, v);
+                        values[start + j + half] = prime.subtract(u, v);
                     }
                 }
             }
-
-            return std::strong_ordering::equal;
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        [[nodiscard]] constexpr bool operator==(bigint<other_bits, other_signedness> const &other) const {
-            if constexpr (bits < other_bits) {
-                return other == *this;
+        // The cyclic convolution of lhs and rhs modulo prime, in normal form. Both spans fit into
+        // length, a power of two, so the convolution does not wrap.
+        [[nodiscard]] constexpr std::vector<limb> ntt_convolution(std::span<limb const> const lhs, std::span<limb const> const rhs,
+                                                                  bool const square, std::size_t const length,
+                                                                  ntt_prime const &prime) {
+            auto roots = std::vector<limb>(length / 2);
+            auto inverse_roots = std::vector<limb>(length / 2);
+            auto const w = prime.root(length);
+            auto const w_inverse = prime.to_montgomery(prime.power(prime.multiply(w, 1), length - 1));
+            roots[0] = inverse_roots[0] = prime.to_montgomery(1);
+            for (auto const j: std::views::iota(1uz, length / 2)) {
+                roots[j] = prime.multiply(roots[j - 1], w);
+                inverse_roots[j] = prime.multiply(inverse_roots[j - 1], w_inverse);
+            }
+
+            auto const load = [&](std::span<limb const> const value) {
+                auto result = std::vector<limb>(length);
+                for (auto const i: std::views::iota(0uz, value.size())) {
+                    result[i] = prime.to_montgomery(value[i]);
+                }
+                ntt_forward(result, roots, prime);
+                return result;
+            };
+            auto values = load(lhs);
+            if (square) {
+                for (auto &value: values) {
+                    value = prime.multiply(value, value);
+                }
             } else {
-                static_assert(bits >= other_bits, "Can't compare values with a larger bit count than the target type.");
-                if constexpr (other_signedness == Signedness::Signed and signedness == Signedness::Unsigned) {
-                    if (other < std::int8_t{0}) {
-                        return false;
-                    }
+                auto const other = load(rhs);
+                for (auto const i: std::views::iota(0uz, length)) {
+                    values[i] = prime.multiply(values[i], other[i]);
                 }
+            }
+            ntt_inverse(values, inverse_roots, prime);
+
+            // The values carry one Montgomery factor; multiplying by the plain 1 / length removes it.
+            auto const scale = prime.power(length, prime.modulus() - 2);
+            for (auto &value: values) {
+                value = prime.multiply(value, scale);
+            }
+            return values;
+        }
 
-                auto fill = std::uint8_t{0};
-                if constexpr (other_signedness == Signedness::Signed) {
-                    fill = other < std::int8_t{0} ? 0xFF : 0;
+        // Product by number-theoretic transforms modulo three primes, combined with Garner's CRT.
+        // The transform length follows the significant limbs, so small values stay cheap.
+        template<std::size_t n, typename Fork>
+        constexpr void multiply_ntt(std::array<limb, n> const &lhs, std::array<limb, n> const &rhs,
+                                    std::array<limb, 2 * n> &result, Fork const &fork) {
+            auto const square = std::addressof(lhs) == std::addressof(rhs);
+            auto const lhs_size = significant_limbs(lhs);
+            auto const rhs_size = significant_limbs(rhs);
+            result.fill(0);
+            // A short operand is cheaper to multiply limb by limb than to transform.
+            if (std::min(lhs_size, rhs_size) < karatsuba_threshold) {
+                for (auto const i: std::views::iota(0uz, lhs_size)) {
+                    auto carry = limb{0};
+                    for (auto const j: std::views::iota(0uz, rhs_size)) {
+                        auto high = limb{0};
+                        auto low = multiply_wide(lhs[i], rhs[j], high);
+                        low += result[i + j];
+                        high += low < result[i + j];
+                        low += carry;
+                        high += low < carry;
+                        result[i + j] = low;
+                        carry = high;
+                    }
+                    result[i + rhs_size] = carry;
                 }
+                return;
+            }
+            auto const length = std::bit_ceil(lhs_size + rhs_size);
+            auto const lhs_span = std::span<limb const>{lhs.data(), lhs_size};
+            auto const rhs_span = std::span<limb const>{rhs.data(), rhs_size};
+            auto residues = std::array<std::vector<limb>, 3>{};
+            fork(n,
+                 [&] { residues[0] = ntt_convolution(lhs_span, rhs_span, square, length, ntt_primes[0]); },
+                 [&] { residues[1] = ntt_convolution(lhs_span, rhs_span, square, length, ntt_primes[1]); },
+                 [&] { residues[2] = ntt_convolution(lhs_span, rhs_span, square, length, ntt_primes[2]); });
+
+            // Garner: x = v0 + v1 * p0 + v2 * p0 * p1 with v1 = (r1 - v0) / p0 mod p1 and
+            // v2 = ((r2 - v0) / p0 - v1) / p1 mod p2. The constants are in Montgomery form so one
+            // Montgomery multiplication applies them. That multiplication accepts any limb as its
+            // first operand, so instead of reducing v0 and v1 a multiple of the modulus larger than
+            // them is added before subtracting.
+            constexpr auto &p0 = ntt_primes[0];
+            constexpr auto &p1 = ntt_primes[1];
+            constexpr auto &p2 = ntt_primes[2];
+            constexpr auto p0_inverse_1 = p1.to_montgomery(p1.power(p0.modulus() % p1.modulus(), p1.modulus() - 2));
+            constexpr auto p0_inverse_2 = p2.to_montgomery(p2.power(p0.modulus() % p2.modulus(), p2.modulus() - 2));
+            constexpr auto p1_inverse_2 = p2.to_montgomery(p2.power(p1.modulus() % p2.modulus(), p2.modulus() - 2));
+            constexpr auto p0_p1 = [] {
+                auto high = limb{0};
+                auto const low = multiply_wide(p0.modulus(), p1.modulus(), high);
+                return std::array{low, high};
+            }();
+
+            auto carry = std::array<limb, 3>{};
+            for (auto const i: std::views::iota(0uz, std::min(lhs_size + rhs_size, 2 * n))) {
+                auto const v0 = residues[0][i];
+                auto const v1 = p1.multiply(residues[1][i] + 2 * p1.modulus() - v0, p0_inverse_1);
+                auto const v2 = p2.multiply(
+                    p2.multiply(residues[2][i] + 3 * p2.modulus() - v0, p0_inverse_2) + 2 * p2.modulus() - v1,
+                    p1_inverse_2);
+
+                // carry += v0 + v1 * p0 + v2 * p0 * p1, then shift out the lowest limb.
+                auto high = limb{0};
+                auto low = multiply_wide(v1, p0.modulus(), high);
+                add_at(carry, 0, std::array{v0});
+                add_at(carry, 0, std::array{low, high});
+                low = multiply_wide(v2, p0_p1[0], high);
+                add_at(carry, 0, std::array{low, high});
+                low = multiply_wide(v2, p0_p1[1], high);
+                add_at(carry, 1, std::array{low, high});
+                result[i] = carry[0];
+                carry = {carry[1], carry[2], 0};
+            }
+        }
 
-                std::array<std::uint8_t, std::to_underlying(bits) / CHAR_BIT> extended{};
-                extended.fill(fill);
+        // Full 2n limb product of two n limb arrays.
+        template<std::size_t n, typename Fork>
+        constexpr void multiply_full(std::array<limb, n> const &lhs, std::array<limb, n> const &rhs,
+                                     std::array<limb, 2 * n> &result, Fork const &fork) {
+            if constexpr (n < karatsuba_threshold) {
+                multiply_schoolbook(lhs, rhs, result);
+            } else if constexpr (n < toom3_threshold) {
+                multiply_karatsuba(lhs, rhs, result, fork);
+            } else if constexpr (n < ntt_threshold) {
+                multiply_toom3(lhs, rhs, result, fork);
+            } else {
+                multiply_ntt(lhs, rhs, result, fork);
+            }
+        }
 
-                if constexpr (std::endian::native == std::endian::little) {
-                    std::copy_n(other.data_.begin(), other.data_.size(), extended.begin());
-                } else {
-                    std::copy_n(other.data_.begin(), other.data_.size(),
-                                extended.begin() + (extended.size() - other.data_.size()));
+        // multiply_full of operands with at most size significant limbs, halving the width while
+        // they fit so that the algorithm follows their size rather than the type's.
+        template<std::size_t n, typename Fork>
+        constexpr void multiply_full_narrow(std::array<limb, n> const &lhs, std::array<limb, n> const &rhs,
+                                            std::size_t const size, std::array<limb, 2 * n> &result, Fork const &fork) {
+            if constexpr (n / 2 >= karatsuba_threshold) {
+                if (size <= n / 2) {
+                    auto product = std::array<limb, 2 * (n / 2)>{};
+                    multiply_full_narrow(slice<n / 2>(lhs), slice<n / 2>(rhs), size, product, fork);
+                    result = slice<2 * n>(product);
+                    return;
                 }
-                return extended == data_;
             }
+            multiply_full(lhs, rhs, result, fork);
         }
 
-        template<std::integral T>
-        constexpr bigint &operator+=(T const other) {
-            *this += bigint{other};
-            return *this;
-        }
+        // Product of two little-endian limb arrays, truncated to n limbs. Narrow operands use the
+        // schoolbook method; otherwise the low halves get a full product and the two cross terms
+        // are only needed modulo B^(n - h), which recurses on the truncated product.
+        template<std::size_t n, typename Fork = sequential_fork>
+        constexpr void multiply(std::array<limb, n> const &lhs, std::array<limb, n> const &rhs,
+                                std::array<limb, n> &result, Fork const &fork = {}) {
+            auto const lhs_size = significant_limbs(lhs);
+            auto const rhs_size = significant_limbs(rhs);
+            // Operands that fit into half the limbs have a product that fits into n limbs, so it is
+            // computed in full at the narrowest width that holds them.
+            if constexpr (n / 2 >= karatsuba_threshold) {
+                if (std::max(lhs_size, rhs_size) <= n / 2 and std::min(lhs_size, rhs_size) >= karatsuba_threshold) {
+                    auto product = std::array<limb, 2 * (n / 2)>{};
+                    multiply_full_narrow(slice<n / 2>(lhs), slice<n / 2>(rhs), std::max(lhs_size, rhs_size), product,
+                                         fork);
+                    result = slice<n>(product);
+                    return;
+                }
+            }
+            // The transform computes all coefficients at the same cost, so splitting off the
+            // cross terms would only add work.
+            if constexpr (n >= ntt_threshold) {
+                if (std::min(lhs_size, rhs_size) >= karatsuba_threshold) {
+                    auto product = std::array<limb, 2 * n>{};
+                    multiply_ntt(lhs, rhs, product, fork);
+                    result = slice<n>(product);
+                    return;
+                }
+            }
+            if constexpr (n >= karatsuba_threshold) {
+                if (std::min(lhs_size, rhs_size) >= karatsuba_threshold) {
+                    constexpr auto h = (n + 1) / 2;
+                    auto low = std::array<limb, 2 * h>{};
+                    auto lhs_cross = std::array<limb, n - h>{};
+                    auto rhs_cross = std::array<limb, n - h>{};
+                    fork(n,
+                         [&] { multiply_full(slice<h>(lhs), slice<h>(rhs), low, fork); },
+                         [&] { multiply(slice<n - h>(lhs, h), slice<n - h>(rhs), lhs_cross, fork); },
+                         [&] { multiply(slice<n - h>(lhs), slice<n - h>(rhs, h), rhs_cross, fork); });
+                    result = slice<n>(low);
+                    add_at(result, h, lhs_cross);
+                    add_at(result, h, rhs_cross);
+                    return;
+                }
+            }
 
-        template<std::integral T>
-        [[nodiscard]] constexpr bigint operator+(T const other) const {
-            auto result = bigint{*this};
-            result += other;
-            return result;
+            result.fill(0);
+            for (auto const i: std::views::iota(0uz, lhs_size)) {
+                if (lhs[i] == 0) {
+                    continue;
+                }
+                auto carry = limb{0};
+                auto const end = std::min(n - i, rhs_size);
+                for (auto const j: std::views::iota(0uz, end)) {
+                    auto high = limb{0};
+                    auto low = multiply_wide(lhs[i], rhs[j], high);
+                    low += result[i + j];
+                    high += low < result[i + j];
+                    low += carry;
+                    high += low < carry;
+                    result[i + j] = low;
+                    carry = high;
+                }
+                if (i + end < n) {
+                    result[i + end] = carry;
+                }
+            }
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        constexpr bigint &operator+=(bigint<other_bits, other_signedness> const &other) {
-            static constexpr std::size_t this_size = std::to_underlying(bits) / CHAR_BIT;
-            static constexpr std::size_t other_size = std::to_underlying(other_bits) / CHAR_BIT;
-            auto carry = std::uint16_t{0};
-
-            auto fill = std::uint8_t{0};
-            if constexpr (other_signedness == Signedness::Signed) {
-                if constexpr (std::endian::native == std::endian::little) {
-                    if (other.data_[other_size - 1] & 0x80) {
-                        fill = 0xFF;
+        // Adds (or subtracts) the rows of lhs * rhs straight into accumulator, truncated to n limbs,
+        // with the shorter operand driving the rows.
+        template<bool subtract, std::size_t n>
+        constexpr void accumulate_rows(std::array<limb, n> const &lhs, std::size_t const lhs_size,
+                                       std::array<limb, n> const &rhs, std::size_t const rhs_size,
+                                       std::array<limb, n> &accumulator) {
+            for (auto const i: std::views::iota(0uz, lhs_size)) {
+                if (lhs[i] == 0) {
+                    continue;
+                }
+                // For subtraction carry is the amount still to be taken from the next limb.
+                auto carry = limb{0};
+                auto const end = std::min(n - i, rhs_size);
+                for (auto const j: std::views::iota(0uz, end)) {
+                    auto high = limb{0};
+                    auto low = multiply_wide(lhs[i], rhs[j], high);
+                    low += carry;
+                    high += low < carry;
+                    auto const current = accumulator[i + j];
+                    if constexpr (subtract) {
+                        accumulator[i + j] = current - low;
+                        high += current < low;
+                    } else {
+                        accumulator[i + j] = current + low;
+                        high += accumulator[i + j] < low;
                     }
-                } else {
-                    if (other.data_[0] & 0x80) {
-                        fill = 0xFF;
+                    carry = high;
+                }
+                for (auto k = i + end; k < n and carry != 0; ++k) {
+                    auto const current = accumulator[k];
+                    if constexpr (subtract) {
+                        accumulator[k] = current - carry;
+                        carry = current < carry;
+                    } else {
+                        accumulator[k] = current + carry;
+                        carry = accumulator[k] < carry;
                     }
                 }
             }
+        }
 
-            for (auto const i: std::views::iota(0uz, this_size)) {
-                if constexpr (std::endian::native == std::endian::little) {
-                    auto const other_byte = std::uint16_t{i < other_size ? other.data_[i] : fill};
-                    auto const sum = static_cast<std::uint16_t>(
-                        static_cast<std::uint16_t>(data_[i]) + other_byte + carry);
-                    data_[i] = static_cast<std::uint8_t>(sum & 0xFF);
-                    carry = sum >> 8;
+        // accumulator += lhs * rhs, or -= when subtract is set, truncated to n limbs. When one side is
+        // narrower than karatsuba_threshold limbs the rows of the product go straight into the
+        // accumulator; wider operands get a product temporary from multiply.
+        template<std::size_t n, typename Fork = sequential_fork>
+        constexpr void accumulate_product(std::array<limb, n> const &lhs, std::array<limb, n> const &rhs,
+                                          std::array<limb, n> &accumulator, bool const subtract,
+                                          Fork const &fork = {}) {
+            auto const lhs_size = significant_limbs(lhs);
+            auto const rhs_size = significant_limbs(rhs);
+            if (std::min(lhs_size, rhs_size) >= karatsuba_threshold) {
+                auto product = std::array<limb, n>{};
+                multiply(lhs, rhs, product, fork);
+                if (subtract) {
+                    subtract_from(accumulator, product);
                 } else {
-                    auto const idx = std::size_t{this_size - 1 - i};
-                    auto const other_byte = std::uint16_t{i < other_size ? other.data_[other_size - 1 - i] : fill};
-                    auto const sum = static_cast<std::uint16_t>(
-                        static_cast<std::uint16_t>(data_[idx]) + other_byte + carry);
-                    data_[idx] = static_cast<std::uint8_t>(sum & 0xFF);
-                    carry = sum >> 8;
+                    add_to(accumulator, product);
                 }
+                return;
+            }
+            auto const swapped = lhs_size > rhs_size;
+            auto const &outer = swapped ? rhs : lhs;
+            auto const &inner = swapped ? lhs : rhs;
+            auto const outer_size = std::min(lhs_size, rhs_size);
+            auto const inner_size = std::max(lhs_size, rhs_size);
+            if (subtract) {
+                accumulate_rows<true>(outer, outer_size, inner, inner_size, accumulator);
+            } else {
+                accumulate_rows<false>(outer, outer_size, inner, inner_size, accumulator);
             }
-            return *this;
-        }
-
-        template<BitWidth other_bits, Signedness other_signedness>
-        [[nodiscard]] constexpr bigint operator+(bigint<other_bits, other_signedness> const &other) const {
-            auto result = bigint{*this};
-            result += other;
-            return result;
         }
 
-        template<std::integral T>
-        constexpr bigint &operator*=(T const other) {
-            *this *= bigint{other};
-            return *this;
+        // Schoolbook square: each cross product is computed once and the sum is doubled before the
+        // diagonal is added. Like multiply_schoolbook it does not branch on the values.
+        template<std::size_t n>
+        constexpr void square_schoolbook(std::array<limb, n> const &value, std::array<limb, 2 * n> &result) {
+            result.fill(0);
+            for (auto const i: std::views::iota(0uz, n)) {
+                auto carry = limb{0};
+                for (auto const j: std::views::iota(i + 1, n)) {
+                    auto high = limb{0};
+                    auto low = multiply_wide(value[i], value[j], high);
+                    low += result[i + j];
+                    high += low < result[i + j];
+                    low += carry;
+                    high += low < carry;
+                    result[i + j] = low;
+                    carry = high;
+                }
+                result[i + n] = carry;
+            }
+            auto carry = limb{0};
+            for (auto &current: result) {
+                current = add_with_carry(current, current, carry);
+            }
+            carry = 0;
+            for (auto const i: std::views::iota(0uz, n)) {
+                auto high = limb{0};
+                auto const low = multiply_wide(value[i], value[i], high);
+                result[2 * i] = add_with_carry(result[2 * i], low, carry);
+                result[2 * i + 1] = add_with_carry(result[2 * i + 1], high, carry);
+            }
         }
 
-        template<std::integral T>
-        [[nodiscard]] constexpr bigint operator*(T const other) const {
-            auto result = bigint{*this};
-            result *= other;
+        template<std::size_t n>
+        constexpr void square_full(std::array<limb, n> const &value, std::array<limb, 2 * n> &result) {
+            if constexpr (n >= karatsuba_threshold) {
+                multiply_full(value, value, result);
+            } else {
+                square_schoolbook(value, result);
+            }
+        }
+
+        // Swaps lhs and rhs when condition is 1 using masks instead of a branch.
+        template<std::size_t n>
+        constexpr void conditional_swap(std::array<limb, n> &lhs, std::array<limb, n> &rhs, limb const condition) {
+            auto const mask = limb{0} - condition;
+            for (auto const i: std::views::iota(0uz, n)) {
+                auto const difference = limb{(lhs[i] ^ rhs[i]) & mask};
+                lhs[i] ^= difference;
+                rhs[i] ^= difference;
+            }
+        }
+
+        // Constant-time helpers. Every loop runs a fixed number of iterations for a given n and
+        // conditions are turned into all-zero or all-one masks, so the control flow and memory
+        // accesses only depend on the sizes. Conditions are limbs that are either 0 or 1.
+        [[nodiscard]] constexpr limb mask_from_bit(limb const condition) {
+            return limb{0} - condition;
+        }
+
+        // Returns 1 when lhs < rhs as unsigned numbers, taken from the borrow of lhs - rhs.
+        template<std::size_t n>
+        [[nodiscard]] constexpr limb less_constant_time(std::array<limb, n> const &lhs, std::array<limb, n> const &rhs) {
+            auto borrow = limb{0};
+            for (auto const i: std::views::iota(0uz, n)) {
+                std::ignore = sub_with_borrow(lhs[i], rhs[i], borrow);
+            }
+            return borrow;
+        }
+
+        template<std::size_t n>
+        [[nodiscard]] constexpr limb equal_constant_time(std::array<limb, n> const &lhs, std::array<limb, n> const &rhs) {
+            auto difference = limb{0};
+            for (auto const i: std::views::iota(0uz, n)) {
+                difference |= lhs[i] ^ rhs[i];
+            }
+            return ((difference | (limb{0} - difference)) >> (limb_bits - 1)) ^ 1;
+        }
+
+        // Returns lhs when condition is 1 and rhs otherwise.
+        template<std::size_t n>
+        [[nodiscard]] constexpr std::array<limb, n> select(limb const condition, std::array<limb, n> const &lhs,
+                                                           std::array<limb, n> const &rhs) {
+            auto const mask = mask_from_bit(condition);
+            auto result = std::array<limb, n>{};
+            for (auto const i: std::views::iota(0uz, n)) {
+                result[i] = rhs[i] ^ ((lhs[i] ^ rhs[i]) & mask);
+            }
             return result;
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        constexpr bigint &operator*=(bigint<other_bits, other_signedness> const &other) {
-            auto negative_result = false;
-            auto abs_this = bigint{*this};
-            auto abs_other = bigint{other};
+        // Replaces value by its two's complement when condition is 1.
+        template<std::size_t n>
+        constexpr void conditional_negate(std::array<limb, n> &value, limb const condition) {
+            auto const mask = mask_from_bit(condition);
+            auto carry = condition;
+            for (auto &current: value) {
+                current = add_with_carry(current ^ mask, 0, carry);
+            }
+        }
 
-            if constexpr (signedness == Signedness::Signed) {
-                if (*this < std::int8_t{0}) {
-                    negative_result = !negative_result;
-                    abs_this = -abs_this;
+        // Low n limbs of the product. Unlike multiply it does not skip leading zero limbs.
+        template<std::size_t n>
+        constexpr void multiply_low_constant_time(std::array<limb, n> const &lhs, std::array<limb, n> const &rhs,
+                                                  std::array<limb, n> &result) {
+            result.fill(0);
+            for (auto const i: std::views::iota(0uz, n)) {
+                auto carry = limb{0};
+                for (auto const j: std::views::iota(0uz, n - i)) {
+                    auto high = limb{0};
+                    auto low = multiply_wide(lhs[i], rhs[j], high);
+                    low += result[i + j];
+                    high += low < result[i + j];
+                    low += carry;
+                    high += low < carry;
+                    result[i + j] = low;
+                    carry = high;
                 }
             }
-            if constexpr (other_signedness == Signedness::Signed) {
-                if (other < std::int8_t{0}) {
-                    negative_result = !negative_result;
-                    abs_other = -abs_other;
+        }
+
+        // Restoring binary long division of unsigned values. Each step shifts in one dividend bit
+        // and subtracts the divisor under a mask; the bit shifted out of the top limb covers
+        // divisors that use the full width. divisor must not be zero.
+        template<std::size_t n>
+        constexpr void divide_constant_time(std::array<limb, n> const &dividend, std::array<limb, n> const &divisor,
+                                            std::array<limb, n> &quotient, std::array<limb, n> &remainder) {
+            quotient.fill(0);
+            remainder.fill(0);
+            for (auto const bit: std::views::reverse(std::views::iota(0uz, n * limb_bits))) {
+                auto const overflow = remainder[n - 1] >> (limb_bits - 1);
+                for (auto const i: std::views::reverse(std::views::iota(1uz, n))) {
+                    remainder[i] = (remainder[i] << 1) | (remainder[i - 1] >> (limb_bits - 1));
+                }
+                remainder[0] = (remainder[0] << 1) | ((dividend[bit / limb_bits] >> (bit % limb_bits)) & 1);
+
+                auto difference = std::array<limb, n>{};
+                auto borrow = limb{0};
+                for (auto const i: std::views::iota(0uz, n)) {
+                    difference[i] = sub_with_borrow(remainder[i], divisor[i], borrow);
                 }
+                auto const subtract = limb{overflow | (borrow ^ 1)};
+                remainder = select(subtract, difference, remainder);
+                quotient[bit / limb_bits] |= subtract << (bit % limb_bits);
             }
+        }
 
-            static constexpr auto n = std::size_t{std::to_underlying(bits) / CHAR_BIT};
-            static constexpr auto m = std::size_t{std::to_underlying(other_bits) / CHAR_BIT};
-            auto result = bigint{};
+        // Montgomery reduction: returns t / B^n mod modulus for t < modulus * B^n, where inverse is
+        // -modulus^-1 mod B. The loop and the final subtraction do not branch on the data.
+        template<std::size_t n>
+        [[nodiscard]] constexpr std::array<limb, n> montgomery_reduce(std::array<limb, 2 * n> t,
+                                                                      std::array<limb, n> const &modulus,
+                                                                      limb const inverse) {
+            auto pending = limb{0};
+            for (auto const i: std::views::iota(0uz, n)) {
+                auto const factor = limb{t[i] * inverse};
+                auto carry = limb{0};
+                for (auto const j: std::views::iota(0uz, n)) {
+                    auto high = limb{0};
+                    auto low = multiply_wide(factor, modulus[j], high);
+                    low += carry;
+                    high += low < carry;
+                    low += t[i + j];
+                    high += low < t[i + j];
+                    t[i + j] = low;
+                    carry = high;
+                }
+                t[i + n] = add_with_carry(t[i + n], carry, pending);
+            }
 
+            auto result = slice<n>(t, n);
+            auto difference = result;
+            auto borrow = limb{0};
             for (auto const i: std::views::iota(0uz, n)) {
-                if constexpr (std::endian::native == std::endian::little) {
-                    auto carry = std::uint16_t{0};
-                    for (auto const j: std::views::iota(0uz, m)) {
-                        if (i + j >= n) {
-                            break;
-                        }
-                        auto product = std::uint32_t{
-                            static_cast<std::uint32_t>(abs_this.data_[i]) *
-                            static_cast<std::uint32_t>(abs_other.data_[j])
-                        };
-                        product += static_cast<std::uint32_t>(result.data_[i + j]) + carry;
-                        result.data_[i + j] = static_cast<std::uint8_t>(product & 0xFF);
-                        carry = static_cast<std::uint16_t>(product >> 8);
-                    }
-                    if (i + m < n) {
-                        auto const sum = std::uint32_t{static_cast<std::uint32_t>(result.data_[i + m]) + carry};
-                        result.data_[i + m] = static_cast<std::uint8_t>(sum & 0xFF);
-                    }
+                difference[i] = sub_with_borrow(result[i], modulus[i], borrow);
+            }
+            auto const mask = limb{0} - (pending | (borrow ^ 1));
+            for (auto const i: std::views::iota(0uz, n)) {
+                result[i] = (difference[i] & mask) | (result[i] & ~mask);
+            }
+            return result;
+        }
+
+        // The multi-limb part of Algorithm D, divisor_size must be at least two.
+        template<std::size_t n>
+        constexpr void divide_normalized(std::array<limb, n> const &dividend, std::array<limb, n> const &divisor,
+                                         std::size_t const dividend_size, std::size_t const divisor_size,
+                                         std::array<limb, n> &quotient, std::array<limb, n> &remainder) {
+            // D1: normalize so that the top limb of the divisor has its highest bit set.
+            auto const shift = static_cast<std::size_t>(std::countl_zero(divisor[divisor_size - 1]));
+            auto v = std::array<limb, n>{};
+            auto u = std::array<limb, n + 1>{};
+            for (auto const i: std::views::iota(0uz, divisor_size)) {
+                v[i] = divisor[i] << shift;
+                if (shift != 0 and i > 0) {
+                    v[i] |= divisor[i - 1] >> (limb_bits - shift);
+                }
+            }
+            for (auto const i: std::views::iota(0uz, dividend_size + 1)) {
+                u[i] = i < dividend_size ? dividend[i] << shift : 0;
+                if (shift != 0 and i > 0) {
+                    u[i] |= dividend[i - 1] >> (limb_bits - shift);
+                }
+            }
+
+            auto const v_top = v[divisor_size - 1];
+            auto const v_next = v[divisor_size - 2];
+            for (auto const j: std::views::reverse(std::views::iota(0uz, dividend_size - divisor_size + 1))) {
+                // D3: estimate the quotient limb from the top two limbs and refine it with the third.
+                auto estimate = limb{0};
+                auto rest = limb{0};
+                auto rest_overflow = false;
+                if (u[j + divisor_size] >= v_top) {
+                    estimate = ~limb{0};
+                    rest = u[j + divisor_size - 1] + v_top;
+                    rest_overflow = rest < v_top;
                 } else {
-                    auto const idx1 = std::size_t{n - 1 - i};
-                    auto carry = std::uint16_t{0};
-                    for (auto const j: std::views::iota(0uz, m)) {
-                        if (i + j >= n) {
-                            break;
-                        }
-                        auto const idx2 = std::size_t{n - 1 - j};
-                        auto const result_idx = std::size_t{n - 1 - (i + j)};
-                        auto product = std::uint32_t{
-                            static_cast<std::uint32_t>(abs_this.data_[idx1]) *
-                            static_cast<std::uint32_t>(abs_other.data_[idx2])
-                        };
-                        product += static_cast<std::uint32_t>(result.data_[result_idx]) + carry;
-                        result.data_[result_idx] = static_cast<std::uint8_t>(product & 0xFF);
-                        carry = static_cast<std::uint16_t>(product >> 8);
+                    estimate = divide_wide(u[j + divisor_size], u[j + divisor_size - 1], v_top, rest);
+                }
+                while (not rest_overflow) {
+                    auto product_high = limb{0};
+                    auto const product_low = multiply_wide(estimate, v_next, product_high);
+                    if (product_high < rest or (product_high == rest and product_low <= u[j + divisor_size - 2])) {
+                        break;
                     }
-                    if (i + m < n) {
-                        auto const result_idx = std::size_t{n - 1 - (i + m)};
-                        auto const sum = std::uint32_t{static_cast<std::uint32_t>(result.data_[result_idx]) + carry};
-                        result.data_[result_idx] = static_cast<std::uint8_t>(sum & 0xFF);
+                    --estimate;
+                    rest += v_top;
+                    rest_overflow = rest < v_top;
+                }
+
+                // D4: multiply and subtract.
+                auto carry = limb{0};
+                auto borrow = limb{0};
+                for (auto const i: std::views::iota(0uz, divisor_size)) {
+                    auto high = limb{0};
+                    auto low = multiply_wide(estimate, v[i], high);
+                    low += carry;
+                    high += low < carry;
+                    carry = high;
+                    u[i + j] = sub_with_borrow(u[i + j], low, borrow);
+                }
+                u[j + divisor_size] = sub_with_borrow(u[j + divisor_size], carry, borrow);
+
+                // D6: the estimate was one too large, add the divisor back.
+                if (borrow != 0) {
+                    --estimate;
+                    carry = 0;
+                    for (auto const i: std::views::iota(0uz, divisor_size)) {
+                        u[i + j] = add_with_carry(u[i + j], v[i], carry);
                     }
+                    u[j + divisor_size] += carry;
                 }
+                quotient[j] = estimate;
             }
-            if constexpr (signedness == Signedness::Signed) {
-                if (negative_result) {
-                    result = -result;
+
+            // D8: the remainder is the low part of u shifted back.
+            for (auto const i: std::views::iota(0uz, divisor_size)) {
+                remainder[i] = u[i] >> shift;
+                if (shift != 0) {
+                    remainder[i] |= u[i + 1] << (limb_bits - shift);
                 }
             }
-            *this = result;
-            return *this;
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        [[nodiscard]] constexpr bigint operator*(bigint<other_bits, other_signedness> const &other) const {
-            auto result = bigint{*this};
-            result *= other;
+        // Unsigned division of two little-endian limb arrays using Knuth's Algorithm D
+        // (TAOCP Vol. 2, 4.3.1). The divisor must not be zero.
+        template<std::size_t n>
+        constexpr void divide(std::array<limb, n> const &dividend, std::array<limb, n> const &divisor,
+                              std::array<limb, n> &quotient, std::array<limb, n> &remainder) {
+            quotient.fill(0);
+            remainder.fill(0);
+
+            auto const dividend_size = significant_limbs(dividend);
+            auto const divisor_size = significant_limbs(divisor);
+
+            if (dividend_size < divisor_size) {
+                remainder = dividend;
+                return;
+            }
+
+            if (divisor_size <= 1) {
+                auto rest = limb{0};
+                for (auto const i: std::views::reverse(std::views::iota(0uz, dividend_size))) {
+                    quotient[i] = divide_wide(rest, dividend[i], divisor[0], rest);
+                }
+                remainder[0] = rest;
+                return;
+            }
+            if constexpr (n > 1) {
+                divide_normalized(dividend, divisor, dividend_size, divisor_size, quotient, remainder);
+            }
+        }
+
+        // The largest power of ten that fits into a limb, used to convert 19 decimal digits per division.
+        inline constexpr auto decimal_chunk = limb{10'000'000'000'000'000'000ull};
+        inline constexpr auto decimal_chunk_digits = std::size_t{19};
+        inline constexpr auto decimal_chunk_reciprocal = make_reciprocal(decimal_chunk);
+
+        // 10^k for k from 0 to 19.
+        inline constexpr auto powers_of_ten = []() consteval {
+            auto result = std::array<limb, decimal_chunk_digits + 1>{};
+            result[0] = 1;
+            for (auto const k: std::views::iota(1uz, result.size())) {
+                result[k] = result[k - 1] * 10;
+            }
+            return result;
+        }();
+
+        // Values with more significant limbs than this are converted by divide and conquer.
+        inline constexpr auto decimal_split_threshold = std::size_t{32};
+
+        // Decimal strings with more digits than fit into this many limbs (19 per limb) are parsed
+        // by divide and conquer. The products only pay off at larger sizes than the divisions of
+        // the output, so the threshold is separate.
+        inline constexpr std::size_t decimal_parse_threshold = bigint_DECIMAL_PARSE_THRESHOLD;
+
+        inline constexpr auto decimal_digit_pairs = [] {
+            auto result = std::array<char, 200>{};
+            for (auto const i: std::views::iota(0uz, 100uz)) {
+                result[2 * i] = static_cast<char>('0' + i / 10);
+                result[2 * i + 1] = static_cast<char>('0' + i % 10);
+            }
             return result;
+        }();
+
+        // Writes exactly digits decimal digits of value so that they end at last, returns the first one.
+        constexpr char *write_decimal_chunk(limb value, char *last, std::size_t digits) {
+            for (; digits >= 2; digits -= 2) {
+                auto const pair = static_cast<std::size_t>(value % 100) * 2;
+                value /= 100;
+                *--last = decimal_digit_pairs[pair + 1];
+                *--last = decimal_digit_pairs[pair];
+            }
+            if (digits != 0) {
+                *--last = static_cast<char>('0' + value % 10);
+            }
+            return last;
         }
 
-        template<std::integral T>
-        constexpr bigint &operator-=(T const other) {
-            *this -= bigint{other};
-            return *this;
+        [[nodiscard]] constexpr std::size_t decimal_digits(limb const value) {
+            auto digits = std::size_t{1};
+            while (digits < powers_of_ten.size() and value >= powers_of_ten[digits]) {
+                ++digits;
+            }
+            return digits;
         }
 
-        template<std::integral T>
-        [[nodiscard]] constexpr bigint operator-(T const other) const {
-            auto result = bigint{*this};
-            result -= other;
+        // Writes value as decimal digits ending at last, peeling off 19 digits per single limb division.
+        // The output is padded with zeros to at least min_digits. Returns the first digit.
+        template<std::size_t n>
+        constexpr char *format_decimal_chunked(std::array<limb, n> value, char *last, std::size_t const min_digits) {
+            auto const end = last;
+            auto size = significant_limbs(value);
+            while (size > 0) {
+                auto const chunk = divide_in_place(value, size, decimal_chunk_reciprocal);
+                while (size > 0 and value[size - 1] == 0) {
+                    --size;
+                }
+                last = write_decimal_chunk(chunk, last, size > 0 ? decimal_chunk_digits : decimal_digits(chunk));
+            }
+            while (static_cast<std::size_t>(end - last) < min_digits) {
+                *--last = '0';
+            }
+            return last;
+        }
+
+        // powers[k] holds 10^(19 * 2^k); levels is the number of valid entries.
+        template<std::size_t n>
+        struct decimal_powers {
+            std::array<std::array<limb, n>, std::bit_width(n) + 1> powers{};
+            std::size_t levels{};
+        };
+
+        template<std::size_t n, typename Fork>
+        [[nodiscard]] constexpr decimal_powers<n> make_decimal_powers(std::size_t const size, Fork const &fork) {
+            auto result = decimal_powers<n>{};
+            result.powers[0][0] = decimal_chunk;
+            result.levels = 1;
+            while (result.levels < result.powers.size() and
+                   2 * significant_limbs(result.powers[result.levels - 1]) <= size) {
+                auto const &previous = result.powers[result.levels - 1];
+                multiply(previous, previous, result.powers[result.levels], fork);
+                ++result.levels;
+            }
             return result;
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        constexpr bigint &operator-=(bigint<other_bits, other_signedness> const &other) {
-            static constexpr auto this_size = std::size_t{std::to_underlying(bits) / CHAR_BIT};
-            static constexpr auto other_size = std::size_t{std::to_underlying(other_bits) / CHAR_BIT};
-
-            auto fill = std::uint8_t{0};
-            if constexpr (other_signedness == Signedness::Signed and other_size <= this_size) {
-                if constexpr (std::endian::native == std::endian::little) {
-                    if (other.data_[other_size - 1] & 0x80) {
-                        fill = 0xFF;
-                    }
-                } else {
-                    if (other.data_[0] & 0x80) {
-                        fill = 0xFF;
-                    }
-                }
+        template<std::size_t n, typename Fork>
+        constexpr char *format_decimal_split(std::array<limb, n> const &value, char *last, std::size_t const min_digits,
+                                             decimal_powers<n> const &table, Fork const &fork) {
+            auto const size = significant_limbs(value);
+            auto level = table.levels;
+            while (level > 0 and 2 * significant_limbs(table.powers[level - 1]) > size + 1) {
+                --level;
+            }
+            if (size <= decimal_split_threshold or level <= 1) {
+                return format_decimal_chunked(value, last, min_digits);
             }
 
-            std::uint16_t borrow = 0;
-            for (auto const i: std::views::iota(0uz, this_size)) {
-                if constexpr (std::endian::native == std::endian::little) {
-                    auto const other_byte = std::uint16_t{i < other_size ? other.data_[i] : fill};
-                    auto diff = static_cast<std::int16_t>(
-                        static_cast<std::int16_t>(data_[i]) - static_cast<std::int16_t>(other_byte) - borrow
-                    );
-                    if (diff < 0) {
-                        diff += 256;
-                        borrow = 1;
-                    } else {
-                        borrow = 0;
-                    }
-                    data_[i] = static_cast<std::uint8_t>(diff);
-                } else {
-                    auto idx = std::size_t{this_size - 1 - i};
-                    auto const other_byte = std::uint16_t{i < other_size ? other.data_[other_size - 1 - i] : fill};
-                    auto diff = static_cast<std::int16_t>(
-                        static_cast<std::int16_t>(data_[idx]) - static_cast<std::int16_t>(other_byte) - borrow
-                    );
-                    if (diff < 0) {
-                        diff += 256;
-                        borrow = 1;
+            // value = high * 10^low_digits + low, where low is printed with all its leading zeros. That
+            // fixes where the digits of high end, so both halves can be written independently.
+            auto const low_digits = decimal_chunk_digits << (level - 1);
+            auto high = std::array<limb, n>{};
+            auto low = std::array<limb, n>{};
+            divide(value, table.powers[level - 1], high, low);
+            auto first = last;
+            fork(size,
+                 [&] { std::ignore = format_decimal_split(low, last, low_digits, table, fork); },
+                 [&] {
+                     first = format_decimal_split(high, last - low_digits,
+                                                  min_digits > low_digits ? min_digits - low_digits : 0, table, fork);
+                 });
+            return first;
+        }
+
+        // Up to this many limbs the powers of ten for the full width are generated by the compiler.
+        // Wider tables exceed the constant evaluation limits and are computed once on first use.
+        inline constexpr auto constant_decimal_powers_limit = std::size_t{128};
+
+        template<std::size_t n>
+            requires (n <= constant_decimal_powers_limit)
+        inline constexpr auto constant_decimal_powers = make_decimal_powers<n>(n, sequential_fork{});
+
+        template<std::size_t n>
+        [[nodiscard]] decimal_powers<n> const &cached_decimal_powers() {
+            if constexpr (n <= constant_decimal_powers_limit) {
+                return constant_decimal_powers<n>;
+            } else {
+                static auto const table = make_decimal_powers<n>(n, sequential_fork{});
+                return table;
+            }
+        }
+
+        // Writes the unsigned value as decimal digits ending at last and returns the first digit.
+        // Nothing is written for zero.
+        template<std::size_t n, typename Fork = sequential_fork>
+        constexpr char *format_decimal(std::array<limb, n> const &value, char *last, Fork const &fork = {}) {
+            auto const size = significant_limbs(value);
+            if constexpr (n > decimal_split_threshold) {
+                if (size > decimal_split_threshold) {
+                    if constexpr (n <= constant_decimal_powers_limit) {
+                        return format_decimal_split(value, last, 0, constant_decimal_powers<n>, fork);
                     } else {
-                        borrow = 0;
+                        if !consteval {
+                            return format_decimal_split(value, last, 0, cached_decimal_powers<n>(), fork);
+                        }
+                        return format_decimal_split(value, last, 0, make_decimal_powers<n>(size, fork), fork);
                     }
-                    data_[idx] = static_cast<std::uint8_t>(diff);
                 }
             }
-            return *this;
+            return format_decimal_chunked(value, last, 0);
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        [[nodiscard]] constexpr bigint operator-(bigint<other_bits, other_signedness> const &other) const {
-            auto result = bigint{*this};
-            result -= other;
-            return result;
+        inline constexpr auto digit_characters = std::string_view{"0123456789abcdefghijklmnopqrstuvwxyz"};
+
+        // Returns the value of a digit in bases up to 36, or 36 for any character that is not a digit.
+        [[nodiscard]] constexpr limb digit_value(char const c) {
+            if (c >= '0' and c <= '9') {
+                return static_cast<limb>(c - '0');
+            }
+            if (c >= 'a' and c <= 'z') {
+                return static_cast<limb>(c - 'a' + 10);
+            }
+            if (c >= 'A' and c <= 'Z') {
+                return static_cast<limb>(c - 'A' + 10);
+            }
+            return 36;
         }
 
-        template<std::integral T>
-        constexpr bigint &operator/=(T const other) {
-            *this /= bigint{other};
-            return *this;
+        // The largest power of a base that fits into a limb together with its number of digits and
+        // its reciprocal.
+        struct radix_chunk {
+            limb divisor;
+            std::size_t digits;
+            limb_reciprocal reciprocal;
+        };
+
+        [[nodiscard]] consteval radix_chunk make_radix_chunk(limb const base) {
+            auto divisor = base;
+            auto digits = std::size_t{1};
+            while (divisor <= ~limb{0} / base) {
+                divisor *= base;
+                ++digits;
+            }
+            return {divisor, digits, make_reciprocal(divisor)};
         }
 
-        template<std::integral T>
-        [[nodiscard]] constexpr bigint operator/(T const other) const {
-            auto result = bigint{*this};
-            result /= other;
+        // The chunks for the bases 2 to 36, indexed by the base.
+        inline constexpr auto radix_chunks = []() consteval {
+            auto result = std::array<radix_chunk, 37>{};
+            for (auto const base: std::views::iota(limb{2}, limb{result.size()})) {
+                result[base] = make_radix_chunk(base);
+            }
             return result;
+        }();
+
+        // value = value * multiplier + addend over the size significant limbs of value, which grows
+        // by the limb carried out of the top. Returns false when that limb does not fit.
+        template<std::size_t n>
+        constexpr bool multiply_add(std::array<limb, n> &value, std::size_t &size, limb const multiplier,
+                                    limb const addend) {
+            auto carry = addend;
+            for (auto const i: std::views::iota(0uz, size)) {
+                auto high = limb{0};
+                auto low = multiply_wide(value[i], multiplier, high);
+                low += carry;
+                high += low < carry;
+                value[i] = low;
+                carry = high;
+            }
+            if (carry == 0) {
+                return true;
+            }
+            if (size == n) {
+                return false;
+            }
+            value[size++] = carry;
+            return true;
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        constexpr bigint &operator/=(bigint<other_bits, other_signedness> const &other) {
-            if (other == std::int8_t{0}) {
-                throw std::overflow_error("Division by zero");
+        // Writes the unsigned value with shift bits per digit ending at last, taking the digits
+        // straight from the bits. Nothing is written for zero.
+        template<std::size_t n>
+        constexpr char *format_power_of_two(std::array<limb, n> const &value, char *last, std::size_t const shift) {
+            auto const bit_count = significant_bits(value);
+            auto const mask = limb{(limb{1} << shift) - 1};
+            for (auto position = 0uz; position < bit_count; position += shift) {
+                auto const index = position / limb_bits;
+                auto const offset = position % limb_bits;
+                auto digit = limb{value[index] >> offset};
+                if (offset + shift > limb_bits and index + 1 < n) {
+                    digit |= value[index + 1] << (limb_bits - offset);
+                }
+                *--last = digit_characters[digit & mask];
             }
+            return last;
+        }
 
-            auto quotient = bigint{};
-            auto remainder = bigint{};
-            static constexpr auto total_bits = std::to_underlying(bits);
+        // Writes the unsigned value in the given base (2 to 36) ending at last and returns the first
+        // digit. Nothing is written for zero.
+        template<std::size_t n>
+        constexpr char *format_radix(std::array<limb, n> value, char *last, limb const base) {
+            if (base == 10) {
+                return format_decimal(value, last);
+            }
+            if (std::has_single_bit(base)) {
+                return format_power_of_two(value, last, static_cast<std::size_t>(std::countr_zero(base)));
+            }
 
-            for (auto const i: std::views::reverse(std::views::iota(0uz, total_bits))) {
-                remainder <<= std::int8_t{1};
-                if (this->get_bit(i)) {
-                    remainder += std::int8_t{1};
+            auto const &chunk = radix_chunks[base];
+            auto size = significant_limbs(value);
+            while (size > 0) {
+                auto rest = divide_in_place(value, size, chunk.reciprocal);
+                while (size > 0 and value[size - 1] == 0) {
+                    --size;
                 }
-                if (remainder >= other) {
-                    remainder -= other;
-                    quotient.set_bit(i, true);
+                for (auto i = 0uz; i < chunk.digits and (size > 0 or rest != 0); ++i) {
+                    *--last = digit_characters[rest % base];
+                    rest /= base;
                 }
             }
-            *this = quotient;
-            return *this;
+            return last;
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        [[nodiscard]] constexpr bigint operator/(bigint<other_bits, other_signedness> const &other) const {
-            auto result = bigint{*this};
-            result /= other;
+        // SWAR helpers that look at eight characters at once, loaded into a limb with the first
+        // character in the lowest byte.
+        inline constexpr auto swar_ones = limb{0x0101010101010101};
+        inline constexpr auto swar_high = limb{0x8080808080808080};
+
+        [[nodiscard]] constexpr limb load_characters(char const *first) {
+            auto result = limb{0};
+            for (auto const i: std::views::iota(0uz, 8uz)) {
+                result |= limb{static_cast<unsigned char>(first[i])} << (8 * i);
+            }
             return result;
         }
 
-        template<std::integral T>
-        constexpr bigint &operator%=(T const other) {
-            *this %= bigint{other};
-            return *this;
+        // Sets the high bit of each byte in [low, high]. All bytes must be below 0x80, so that the
+        // additions do not carry from one byte into the next.
+        [[nodiscard]] constexpr limb bytes_in_range(limb const chunk, limb const low, limb const high) {
+            return (chunk + swar_ones * (0x80 - low)) & ~(chunk + swar_ones * (0x7f - high)) & swar_high;
         }
 
-        template<std::integral T>
-        [[nodiscard]] constexpr bigint operator%(T const other) const {
-            auto result = bigint{*this};
-            result %= other;
-            return result;
+        [[nodiscard]] constexpr bool is_eight_decimal(limb const chunk) {
+            return (chunk & swar_high) == 0 and bytes_in_range(chunk, '0', '9') == swar_high;
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        constexpr bigint &operator%=(bigint<other_bits, other_signedness> const &other) {
-            if (other == std::int8_t{0}) {
-                throw std::overflow_error("Division by zero");
+        // The value of eight decimal digits with the first one most significant: adjacent digits
+        // are combined into pairs, and the four pairs are scaled and summed in two multiplications.
+        [[nodiscard]] constexpr limb eight_decimal_value(limb chunk) {
+            chunk -= swar_ones * '0';
+            chunk = chunk * 10 + (chunk >> 8);
+            return ((chunk & 0x000000ff000000ff) * (100 + (1000000ull << 32)) +
+                    ((chunk >> 16) & 0x000000ff000000ff) * (1 + (10000ull << 32))) >> 32;
+        }
+
+        // Stores the value of eight hexadecimal digits with the first one most significant and
+        // returns true, or returns false if one of the characters is not a hexadecimal digit.
+        [[nodiscard]] constexpr bool eight_hexadecimal_value(limb const chunk, limb &value) {
+            if ((chunk & swar_high) != 0) {
+                return false;
             }
+            auto const digits = bytes_in_range(chunk, '0', '9');
+            auto const letters = bytes_in_range(chunk | (swar_ones * 0x20), 'a', 'f');
+            if ((digits | letters) != swar_high) {
+                return false;
+            }
+            // One nibble per byte, then pairs of nibbles, pairs of bytes and pairs of halves.
+            auto nibbles = (chunk & (swar_ones * 0x0f)) + (letters >> 7) * 9;
+            nibbles = ((nibbles & 0x0f000f000f000f00) >> 8) | ((nibbles & 0x000f000f000f000f) << 4);
+            nibbles = ((nibbles & 0x00ff000000ff0000) >> 16) | ((nibbles & 0x000000ff000000ff) << 8);
+            value = ((nibbles & 0x0000ffff00000000) >> 32) | ((nibbles & 0x000000000000ffff) << 16);
+            return true;
+        }
 
-            auto remainder = bigint{};
-            static constexpr auto total_bits = std::to_underlying(bits);
+        // Stores the value of eight binary digits with the first one most significant and returns
+        // true, or returns false if one of the characters is not '0' or '1'. The multiplication
+        // moves the bit of byte i to bit 63 - i without any two partial products overlapping.
+        [[nodiscard]] constexpr bool eight_binary_value(limb const chunk, limb &value) {
+            if ((chunk & ~swar_ones) != swar_ones * '0') {
+                return false;
+            }
+            value = ((chunk & swar_ones) * 0x8040201008040201) >> 56;
+            return true;
+        }
 
-            for (auto const i: std::views::reverse(std::views::iota(0uz, total_bits))) {
-                remainder <<= std::int8_t{1};
-                if (this->get_bit(i)) {
-                    remainder += std::int8_t{1};
+        // Accumulates a string of decimal digits into value with one multiply-add per 19 digits.
+        // Returns false when the value does not fit.
+        template<std::size_t n>
+        constexpr bool parse_decimal_chunked(std::string_view const digits, std::array<limb, n> &value) {
+            value.fill(0);
+            auto size = 0uz;
+            for (auto first = 0uz; first < digits.size(); first += decimal_chunk_digits) {
+                auto const count = std::min(digits.size() - first, decimal_chunk_digits);
+                auto accumulated = limb{0};
+                auto i = 0uz;
+                for (; i + 8 <= count; i += 8) {
+                    accumulated = accumulated * powers_of_ten[8] + eight_decimal_value(load_characters(&digits[first + i]));
                 }
-
-                if (remainder >= other) {
-                    remainder -= other;
+                for (; i < count; ++i) {
+                    accumulated = accumulated * 10 + static_cast<limb>(digits[first + i] - '0');
+                }
+                if (not multiply_add(value, size, powers_of_ten[count], accumulated)) {
+                    return false;
                 }
             }
-            *this = remainder;
-            return *this;
+            return true;
         }
 
-        template<BitWidth other_bits, Signedness other_signedness>
-        [[nodiscard]] constexpr bigint operator%(bigint<other_bits, other_signedness> const &other) const {
-            auto result = bigint{*this};
-            result %= other;
-            return result;
-        }
+        // The inverse of format_decimal_split: value = high * 10^low_digits + low, where low holds the
+        // last low_digits = 19 * 2^k digits and the power comes from the table. Returns false when
+        // a part is known to reach 2^(64 * (n - 1)), so with one spare limb the products and sums
+        // here never wrap. Parts short enough to fit into half the limbs are parsed at that width.
+        template<std::size_t n, std::size_t m, typename Fork>
+        constexpr bool parse_decimal_split(std::string_view const digits, std::array<limb, n> &value,
+                                           decimal_powers<m> const &table, Fork const &fork) {
+            auto level = table.levels;
+            while (level > 1 and (decimal_chunk_digits << (level - 1)) >= digits.size()) {
+                --level;
+            }
+            if (digits.size() <= decimal_chunk_digits * decimal_parse_threshold or level <= 1) {
+                return parse_decimal_chunked(digits, value);
+            }
 
-        constexpr bigint &operator<<=(std::size_t const shift) {
-            static constexpr auto n = std::size_t{std::to_underlying(bits) / CHAR_BIT};
-            if (shift == 0) {
-                return *this;
+            auto const parse_part = [&table, &fork](std::string_view const part, std::array<limb, n> &target) {
+                constexpr auto h = n / 2;
+                if constexpr (h > decimal_parse_threshold) {
+                    // 10^19 < 2^64, so these digits stay below 2^(64 * (h - 1)).
+                    if (part.size() <= decimal_chunk_digits * (h - 1)) {
+                        auto narrow = std::array<limb, h>{};
+                        std::ignore = parse_decimal_split(part, narrow, table, fork);
+                        target = slice<n>(narrow);
+                        return true;
+                    }
+                }
+                return parse_decimal_split(part, target, table, fork);
+            };
+            auto const low_digits = decimal_chunk_digits << (level - 1);
+            auto const high_digits = digits.size() - low_digits;
+            auto high = std::array<limb, n>{};
+            auto low = std::array<limb, n>{};
+            auto fits = std::array{true, true};
+            fork(digits.size() / decimal_chunk_digits,
+                 [&] { fits[0] = parse_part(digits.substr(high_digits), low); },
+                 [&] { fits[1] = parse_part(digits.substr(0, high_digits), high); });
+            if (not fits[0] or not fits[1]) {
+                return false;
             }
 
-            auto const byte_shift = std::size_t{shift / CHAR_BIT};
-            auto const bit_shift = std::size_t{shift % CHAR_BIT};
-            auto result = std::array<std::uint8_t, n>{};
+            // high * power is below 2^(the sum of their bit counts) and at least 2^(that sum - 2),
+            // and adding low cannot carry past that sum.
+            auto const high_bits = significant_bits(high);
+            if (high_bits == 0) {
+                value = low;
+                return true;
+            }
+            auto const &power = table.powers[level - 1];
+            if (high_bits + significant_bits(power) > n * limb_bits) {
+                return false;
+            }
+            multiply(high, slice<n>(power), value, fork);
+            add_at(value, 0, low);
+            return true;
+        }
 
-            for (auto const i: std::views::iota(0uz, n)) {
-                if constexpr (std::endian::native == std::endian::little) {
-                    if (i + byte_shift < n) {
-                        result[i + byte_shift] = data_[i];
+        // Parses a string of decimal digits into value and returns false when it does not fit. Long
+        // strings in types wider than decimal_parse_threshold limbs are split recursively with the
+        // same powers of ten as the decimal output.
+        template<std::size_t n, typename Fork = sequential_fork>
+        constexpr bool parse_decimal(std::string_view const digits, std::array<limb, n> &value, Fork const &fork = {}) {
+            if constexpr (n > decimal_parse_threshold) {
+                if (digits.size() > decimal_chunk_digits * decimal_parse_threshold) {
+                    auto wide = std::array<limb, n + 1>{};
+                    auto fits = false;
+                    if !consteval {
+                        fits = parse_decimal_split(digits, wide, cached_decimal_powers<n + 1>(), fork);
+                    } else {
+                        auto const size = std::min(n + 1, digits.size() / decimal_chunk_digits + 1);
+                        fits = parse_decimal_split(digits, wide, make_decimal_powers<n + 1>(size, fork), fork);
                     }
-                } else {
-                    if (i >= byte_shift) {
-                        result[i - byte_shift] = data_[i];
+                    value = slice<n>(wide);
+                    return fits and wide[n] == 0;
+                }
+            }
+            return parse_decimal_chunked(digits, value);
+        }
+
+        struct parse_result {
+            char const *ptr;
+            bool overflow;
+        };
+
+        // Accumulates the digits at the start of [first, last) into value, one multiply-add per chunk
+        // of digits that fits into a limb. Parsing stops at the first character that is not a digit
+        // in base; overflow is set when the digits do not fit into n limbs.
+        template<std::size_t n>
+        constexpr parse_result parse_digits(char const *first, char const *last, limb const base,
+                                            std::array<limb, n> &value) {
+            if constexpr (n > decimal_parse_threshold) {
+                if (base == 10) {
+                    auto const end = std::find_if_not(first, last, [](char const c) { return c >= '0' and c <= '9'; });
+                    if (static_cast<std::size_t>(end - first) > decimal_chunk_digits * decimal_parse_threshold) {
+                        auto const fits = parse_decimal({first, static_cast<std::size_t>(end - first)}, value);
+                        return {end, not fits};
                     }
                 }
             }
 
-            if constexpr (std::endian::native == std::endian::little) {
-                auto carry = std::uint16_t{0};
-                for (auto const i: std::views::iota(0uz, n)) {
-                    auto const temp = static_cast<std::uint16_t>(
-                        (static_cast<std::uint16_t>(result[i]) << bit_shift) | carry);
-                    result[i] = static_cast<std::uint8_t>(temp & 0xFF);
-                    carry = temp >> 8;
+            auto const &chunk = radix_chunks[base];
+            auto overflow = false;
+            auto size = 0uz;
+            value.fill(0);
+            while (first != last) {
+                auto accumulated = limb{0};
+                auto scale = limb{1};
+                auto count = 0uz;
+                for (; base == 10 and last - first >= 8 and count + 8 <= chunk.digits; first += 8, count += 8) {
+                    auto const characters = load_characters(first);
+                    if (not is_eight_decimal(characters)) {
+                        break;
+                    }
+                    accumulated = accumulated * powers_of_ten[8] + eight_decimal_value(characters);
+                    scale *= powers_of_ten[8];
                 }
-            } else {
-                auto carry = std::uint16_t{0};
-                for (auto const i: std::views::reverse(std::views::iota(0uz, n))) {
-                    auto const temp = static_cast<std::uint16_t>(
-                        (static_cast<std::uint16_t>(result[i]) << bit_shift) | carry);
-                    result[i] = static_cast<std::uint8_t>(temp & 0xFF);
-                    carry = temp >> 8;
+                for (; first != last and count < chunk.digits; ++first, ++count) {
+                    auto const digit = digit_value(*first);
+                    if (digit >= base) {
+                        break;
+                    }
+                    accumulated = accumulated * base + digit;
+                    scale *= base;
+                }
+                if (count != 0 and not overflow) {
+                    overflow = not multiply_add(value, size, scale, accumulated);
+                }
+                if (count < chunk.digits) {
+                    break;
                 }
             }
-
-            data_ = result;
-            return *this;
+            return {first, overflow};
         }
 
-        [[nodiscard]] constexpr bigint operator<<(std::size_t const shift) const {
-            auto result = bigint{*this};
-            result <<= shift;
-            return result;
+        enum class parse_error : std::uint8_t {
+            none,
+            invalid_digit,
+            digit_out_of_range,
+            overflow
+        };
+
+        // The strings accepted by the constructors may group digits with ' or a space.
+        [[nodiscard]] constexpr bool is_digit_separator(char const c) {
+            return c == '\'' or c == ' ';
         }
 
-        constexpr bigint &operator>>=(std::size_t const shift) {
-            static constexpr auto n = std::size_t{std::to_underlying(bits) / CHAR_BIT};
-            if (shift == 0) {
-                return *this;
+        // Checks a single character of a constructor string, which knows the digits up to f only.
+        [[nodiscard]] constexpr parse_error check_digit(limb const digit, limb const base) {
+            if (digit >= 16) {
+                return parse_error::invalid_digit;
             }
+            return digit >= base ? parse_error::digit_out_of_range : parse_error::none;
+        }
 
-            auto fill = std::uint8_t{0};
-            if constexpr (signedness == Signedness::Signed) {
-                if constexpr (std::endian::native == std::endian::little) {
-                    if (data_[n - 1] & 0x80) {
-                        fill = 0xFF;
-                    }
-                } else {
-                    if (data_[0] & 0x80) {
-                        fill = 0xFF;
+        // Parses a constructor string in base 10 (or any base that is not a power of two). Digits
+        // are gathered into a limb, eight at a time where they are all decimal, and added to value
+        // with one multiply-add per limb worth of digits. All characters are checked before an
+        // overflow is reported.
+        template<std::size_t n>
+        constexpr parse_error parse_separated(std::string_view const str, limb const base, std::array<limb, n> &value) {
+            if constexpr (n > decimal_parse_threshold) {
+                if (base == 10 and str.size() > decimal_chunk_digits * decimal_parse_threshold) {
+                    auto digits = std::string{};
+                    digits.reserve(str.size());
+                    for (auto const c: str) {
+                        if (is_digit_separator(c)) {
+                            continue;
+                        }
+                        if (auto const error = check_digit(digit_value(c), base); error != parse_error::none) {
+                            return error;
+                        }
+                        digits.push_back(c);
                     }
+                    return parse_decimal(digits, value) ? parse_error::none : parse_error::overflow;
                 }
             }
 
-            if (shift >= std::to_underlying(bits)) {
-                data_.fill(fill);
-                return *this;
+            auto const &chunk = radix_chunks[base];
+            auto overflow = false;
+            auto size = 0uz;
+            auto accumulated = limb{0};
+            auto scale = limb{1};
+            auto count = 0uz;
+            auto flush = [&] {
+                if (count != 0 and not overflow) {
+                    overflow = not multiply_add(value, size, scale, accumulated);
+                }
+                accumulated = 0;
+                scale = 1;
+                count = 0;
+            };
+
+            value.fill(0);
+            auto first = str.data();
+            auto const last = first + str.size();
+            while (first != last) {
+                if (base == 10 and last - first >= 8 and count + 8 <= chunk.digits) {
+                    auto const characters = load_characters(first);
+                    if (is_eight_decimal(characters)) {
+                        accumulated = accumulated * powers_of_ten[8] + eight_decimal_value(characters);
+                        scale *= powers_of_ten[8];
+                        first += 8;
+                        if ((count += 8) == chunk.digits) {
+                            flush();
+                        }
+                        continue;
+                    }
+                }
+                auto const c = *first++;
+                if (is_digit_separator(c)) {
+                    continue;
+                }
+                auto const digit = digit_value(c);
+                if (auto const error = check_digit(digit, base); error != parse_error::none) {
+                    return error;
+                }
+                accumulated = accumulated * base + digit;
+                scale *= base;
+                if (++count == chunk.digits) {
+                    flush();
+                }
             }
+            flush();
+            return overflow ? parse_error::overflow : parse_error::none;
+        }
 
-            auto const byte_shift = std::size_t{shift / CHAR_BIT};
-            auto const bit_shift = std::size_t{shift % CHAR_BIT};
-            auto result = std::array<std::uint8_t, n>{};
-
-            for (auto const i: std::views::iota(0uz, n)) {
-                if constexpr (std::endian::native == std::endian::little) {
-                    auto const lower = (i + byte_shift < n) ? data_[i + byte_shift] : fill;
-                    auto const upper = (i + byte_shift + 1 < n) ? data_[i + byte_shift + 1] : fill;
-                    if (bit_shift == 0) {
-                        result[i] = lower;
+        // Parses a constructor string in base 2, 8 or 16 from its last digit on, placing shift bits
+        // per digit straight into value without any multiplication. Runs of eight binary or
+        // hexadecimal digits are converted at once. The leftmost bad character decides the error,
+        // as with parse_separated.
+        template<std::size_t n>
+        constexpr parse_error parse_separated_power_of_two(std::string_view const str, std::size_t const shift,
+                                                           std::array<limb, n> &value) {
+            auto error = parse_error::none;
+            auto overflow = false;
+            auto position = 0uz;
+            auto deposit = [&](limb const bits, std::size_t const width) {
+                auto const index = position / limb_bits;
+                auto const offset = position % limb_bits;
+                position += width;
+                if (bits == 0) {
+                    return;
+                }
+                if (index >= n) {
+                    overflow = true;
+                    return;
+                }
+                value[index] |= bits << offset;
+                if (offset + width > limb_bits) {
+                    auto const spill = limb{bits >> (limb_bits - offset)};
+                    if (index + 1 < n) {
+                        value[index + 1] |= spill;
                     } else {
-                        result[i] = static_cast<std::uint8_t>((lower >> bit_shift) | (upper << (8 - bit_shift)));
+                        overflow = overflow or spill != 0;
                     }
-                } else {
-                    auto const src = static_cast<int>(i) - static_cast<int>(byte_shift);
-                    auto const lower = (src >= 0 and static_cast<std::size_t>(src) < n) ? data_[src] : fill;
-                    auto const src2 = src - 1;
-                    auto const higher = (src2 >= 0 and static_cast<std::size_t>(src2) < n) ? data_[src2] : fill;
-                    if (bit_shift == 0) {
-                        result[i] = lower;
-                    } else {
-                        result[i] = static_cast<std::uint8_t>((lower >> bit_shift) | (higher << (8 - bit_shift)));
+                }
+            };
+
+            value.fill(0);
+            auto const first = str.data();
+            auto last = first + str.size();
+            while (last != first) {
+                if ((shift == 4 or shift == 1) and last - first >= 8) {
+                    auto bits = limb{0};
+                    auto const characters = load_characters(last - 8);
+                    if (shift == 4 ? eight_hexadecimal_value(characters, bits) : eight_binary_value(characters, bits)) {
+                        deposit(bits, 8 * shift);
+                        last -= 8;
+                        continue;
                     }
                 }
-            }
-
-            data_ = result;
-            return *this;
+                auto const c = *--last;
+                if (is_digit_separator(c)) {
+                    continue;
+                }
+                auto const digit = digit_value(c);
+                if (auto const digit_error = check_digit(digit, limb{1} << shift); digit_error != parse_error::none) {
+                    error = digit_error;
+                } else {
+                    deposit(digit, shift);
+                }
+            }
+            if (error != parse_error::none) {
+                return error;
+            }
+            return overflow ? parse_error::overflow : parse_error::none;
+        }
+
+        // Grants the batch operations and the runtime dispatch layer access to the limbs of a bigint.
+        struct limb_access;
+
+        // Folds carry-save sums back into a value: each lane adds acc[j] at limb j % n and the number
+        // of carries it saw one limb higher, truncated to n limbs.
+        template<std::size_t n>
+        constexpr void fold_carry_save(std::array<limb, n> &result, limb const *acc, limb const *carries,
+                                       std::size_t const count) {
+            for (auto const j: std::views::iota(0uz, count)) {
+                auto const position = j % n;
+                auto carry = limb{0};
+                result[position] = add_with_carry(result[position], acc[j], carry);
+                for (auto const i: std::views::iota(position + 1, n)) {
+                    result[i] = add_with_carry(result[i], i == position + 1 ? carries[j] : 0, carry);
+                }
+            }
+        }
+
+#if defined(bigint_HAS_BATCH_SIMD)
+        enum class batch_isa : std::uint8_t {
+            scalar,
+            avx2,
+            avx512
+        };
+
+        [[nodiscard]] inline batch_isa detect_batch_isa() {
+            static auto const isa = [] {
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx512f")) {
+                    return batch_isa::avx512;
+                }
+                if (__builtin_cpu_supports("avx2")) {
+                    return batch_isa::avx2;
+                }
+                return batch_isa::scalar;
+            }();
+            return isa;
+        }
+
+        // The vector kernels treat an array of n-limb values as one stream of limbs and process it
+        // in chunks of lanes limbs. They are used when n divides lanes, so each chunk holds whole
+        // values, or lanes divides n, so each value spans whole chunks.
+        template<std::size_t n, std::size_t lanes>
+        inline constexpr bool batch_fits = n % lanes == 0 or lanes % n == 0;
+
+        struct chunk_masks {
+            unsigned first;
+            unsigned last;
+        };
+
+        // Lanes holding the lowest and the highest limb of a value in chunk q.
+        template<std::size_t n, std::size_t lanes>
+        [[nodiscard]] constexpr chunk_masks make_chunk_masks(std::size_t const q) {
+            if constexpr (n >= lanes) {
+                constexpr auto per_value = n / lanes;
+                return {q % per_value == 0 ? 1u : 0u, q % per_value == per_value - 1 ? 1u << (lanes - 1) : 0u};
+            } else {
+                auto masks = chunk_masks{0, 0};
+                for (auto const j: std::views::iota(0uz, lanes / n)) {
+                    masks.first |= 1u << (j * n);
+                    masks.last |= 1u << (j * n + n - 1);
+                }
+                return masks;
+            }
+        }
+
+        // Carry lookahead over the lanes of a chunk. Lanes that overflowed generate a carry and
+        // lanes that are all ones propagate one, so the lanes receiving a carry are the bits that
+        // change when the shifted generate bits are added to the propagate bits. Carries are kept
+        // from crossing value boundaries. Returns the lanes that must be incremented and updates
+        // carry with the carry out of the chunk.
+        [[nodiscard]] constexpr unsigned lookahead_carries(unsigned const generate, unsigned propagate,
+                                                           chunk_masks const masks, std::size_t const lanes,
+                                                           unsigned &carry) {
+            propagate &= ~masks.last;
+            auto const lookahead = (((generate << 1) | carry) & ~masks.first) + propagate;
+            carry = lookahead >> lanes;
+            return (lookahead ^ propagate) & ((1u << lanes) - 1);
+        }
+
+        // Adds values of n limbs and returns how many values were handled; the caller finishes the rest.
+        template<std::size_t n>
+        __attribute__((target("avx512f"))) inline std::size_t add_avx512(limb *out, limb const *lhs, limb const *rhs,
+                                                                         std::size_t const count) {
+            constexpr auto lanes = 8uz;
+            auto const ones = _mm512_set1_epi64(-1);
+            auto const chunks = count * n / lanes;
+            auto carry = 0u;
+            for (auto const q: std::views::iota(0uz, chunks)) {
+                auto const a = _mm512_loadu_si512(lhs + q * lanes);
+                auto sum = _mm512_add_epi64(a, _mm512_loadu_si512(rhs + q * lanes));
+                auto const incoming = lookahead_carries(_mm512_cmplt_epu64_mask(sum, a),
+                                                        _mm512_cmpeq_epi64_mask(sum, ones),
+                                                        make_chunk_masks<n, lanes>(q), lanes, carry);
+                sum = _mm512_mask_sub_epi64(sum, static_cast<__mmask8>(incoming), sum, ones);
+                _mm512_storeu_si512(out + q * lanes, sum);
+            }
+            return chunks * lanes / n;
+        }
+
+        // AVX2 has no unsigned 64-bit compare, so both sides are biased by the sign bit first.
+        __attribute__((target("avx2"))) inline __m256i less_unsigned_avx2(__m256i const lhs, __m256i const rhs) {
+            auto const bias = _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+            return _mm256_cmpgt_epi64(_mm256_xor_si256(rhs, bias), _mm256_xor_si256(lhs, bias));
+        }
+
+        __attribute__((target("avx2"))) inline unsigned lane_bits_avx2(__m256i const mask) {
+            return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(mask)));
+        }
+
+        template<std::size_t n>
+        __attribute__((target("avx2"))) inline std::size_t add_avx2(limb *out, limb const *lhs, limb const *rhs,
+                                                                    std::size_t const count) {
+            constexpr auto lanes = 4uz;
+            auto const ones = _mm256_set1_epi64x(-1);
+            auto const lane_select = _mm256_setr_epi64x(1, 2, 4, 8);
+            auto const chunks = count * n / lanes;
+            auto carry = 0u;
+            for (auto const q: std::views::iota(0uz, chunks)) {
+                auto const a = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(lhs + q * lanes));
+                auto const b = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(rhs + q * lanes));
+                auto const sum = _mm256_add_epi64(a, b);
+                auto const incoming = lookahead_carries(lane_bits_avx2(less_unsigned_avx2(sum, a)),
+                                                        lane_bits_avx2(_mm256_cmpeq_epi64(sum, ones)),
+                                                        make_chunk_masks<n, lanes>(q), lanes, carry);
+                auto const increment = _mm256_cmpeq_epi64(
+                    _mm256_and_si256(_mm256_set1_epi64x(static_cast<std::int64_t>(incoming)), lane_select), lane_select);
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + q * lanes), _mm256_sub_epi64(sum, increment));
+            }
+            return chunks * lanes / n;
+        }
+
+        // Per lane less and greater bits are combined per value: read as integers, the greater bits
+        // exceed the less bits exactly when the most significant differing limb is greater. The top
+        // limb of a signed value is compared as signed.
+        template<std::size_t n, std::size_t lanes>
+        constexpr void order_chunk(std::strong_ordering *out, std::size_t const q, unsigned const less,
+                                   unsigned const greater, std::strong_ordering &pending) {
+            if constexpr (n >= lanes) {
+                constexpr auto per_value = n / lanes;
+                if ((less | greater) != 0) {
+                    pending = greater <=> less;
+                }
+                if (q % per_value == per_value - 1) {
+                    out[q / per_value] = pending;
+                    pending = std::strong_ordering::equal;
+                }
+            } else {
+                for (auto const j: std::views::iota(0uz, lanes / n)) {
+                    constexpr auto field = (1u << n) - 1;
+                    out[q * (lanes / n) + j] = ((greater >> (j * n)) & field) <=> ((less >> (j * n)) & field);
+                }
+            }
+        }
+
+        template<std::size_t n, bool is_signed>
+        __attribute__((target("avx512f"))) inline std::size_t compare_avx512(std::strong_ordering *out, limb const *lhs,
+                                                                             limb const *rhs, std::size_t const count) {
+            constexpr auto lanes = 8uz;
+            auto const chunks = count * n / lanes;
+            auto pending = std::strong_ordering::equal;
+            for (auto const q: std::views::iota(0uz, chunks)) {
+                auto const a = _mm512_loadu_si512(lhs + q * lanes);
+                auto const b = _mm512_loadu_si512(rhs + q * lanes);
+                auto less = unsigned{_mm512_cmplt_epu64_mask(a, b)};
+                auto greater = unsigned{_mm512_cmpgt_epu64_mask(a, b)};
+                if constexpr (is_signed) {
+                    auto const top = make_chunk_masks<n, lanes>(q).last;
+                    less = (less & ~top) | (_mm512_cmplt_epi64_mask(a, b) & top);
+                    greater = (greater & ~top) | (_mm512_cmpgt_epi64_mask(a, b) & top);
+                }
+                order_chunk<n, lanes>(out, q, less, greater, pending);
+            }
+            return chunks * lanes / n;
+        }
+
+        template<std::size_t n, bool is_signed>
+        __attribute__((target("avx2"))) inline std::size_t compare_avx2(std::strong_ordering *out, limb const *lhs,
+                                                                        limb const *rhs, std::size_t const count) {
+            constexpr auto lanes = 4uz;
+            auto const chunks = count * n / lanes;
+            auto pending = std::strong_ordering::equal;
+            for (auto const q: std::views::iota(0uz, chunks)) {
+                auto const a = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(lhs + q * lanes));
+                auto const b = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(rhs + q * lanes));
+                auto less = lane_bits_avx2(less_unsigned_avx2(a, b));
+                auto greater = lane_bits_avx2(less_unsigned_avx2(b, a));
+                if constexpr (is_signed) {
+                    auto const top = make_chunk_masks<n, lanes>(q).last;
+                    less = (less & ~top) | (lane_bits_avx2(_mm256_cmpgt_epi64(b, a)) & top);
+                    greater = (greater & ~top) | (lane_bits_avx2(_mm256_cmpgt_epi64(a, b)) & top);
+                }
+                order_chunk<n, lanes>(out, q, less, greater, pending);
+            }
+            return chunks * lanes / n;
+        }
+
+        // Carry-save sum: every lane accumulates its limbs and counts its overflows independently,
+        // with one accumulator per chunk position when a value spans several chunks.
+        template<std::size_t n>
+        __attribute__((target("avx512f"))) inline std::size_t sum_avx512(std::array<limb, n> &result,
+                                                                         limb const *values, std::size_t const count) {
+            constexpr auto lanes = 8uz;
+            constexpr auto phases = n > lanes ? n / lanes : 1uz;
+            auto const ones = _mm512_set1_epi64(-1);
+            auto const chunks = count * n / lanes;
+            // Vector types carry alignment attributes that std::array would drop.
+            __m512i acc[phases]{};
+            __m512i carries[phases]{};
+            for (auto const q: std::views::iota(0uz, chunks)) {
+                auto const value = _mm512_loadu_si512(values + q * lanes);
+                auto &current = acc[q % phases];
+                current = _mm512_add_epi64(current, value);
+                carries[q % phases] = _mm512_mask_sub_epi64(carries[q % phases], _mm512_cmplt_epu64_mask(current, value),
+                                                            carries[q % phases], ones);
+            }
+            auto acc_limbs = std::array<limb, phases * lanes>{};
+            auto carry_limbs = std::array<limb, phases * lanes>{};
+            for (auto const p: std::views::iota(0uz, phases)) {
+                _mm512_storeu_si512(acc_limbs.data() + p * lanes, acc[p]);
+                _mm512_storeu_si512(carry_limbs.data() + p * lanes, carries[p]);
+            }
+            fold_carry_save(result, acc_limbs.data(), carry_limbs.data(), phases * lanes);
+            return chunks * lanes / n;
+        }
+
+        template<std::size_t n>
+        __attribute__((target("avx2"))) inline std::size_t sum_avx2(std::array<limb, n> &result,
+                                                                    limb const *values, std::size_t const count) {
+            constexpr auto lanes = 4uz;
+            constexpr auto phases = n > lanes ? n / lanes : 1uz;
+            auto const chunks = count * n / lanes;
+            // Vector types carry alignment attributes that std::array would drop.
+            __m256i acc[phases]{};
+            __m256i carries[phases]{};
+            for (auto const q: std::views::iota(0uz, chunks)) {
+                auto const value = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(values + q * lanes));
+                auto &current = acc[q % phases];
+                current = _mm256_add_epi64(current, value);
+                carries[q % phases] = _mm256_sub_epi64(carries[q % phases], less_unsigned_avx2(current, value));
+            }
+            auto acc_limbs = std::array<limb, phases * lanes>{};
+            auto carry_limbs = std::array<limb, phases * lanes>{};
+            for (auto const p: std::views::iota(0uz, phases)) {
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc_limbs.data() + p * lanes), acc[p]);
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(carry_limbs.data() + p * lanes), carries[p]);
+            }
+            fold_carry_save(result, acc_limbs.data(), carry_limbs.data(), phases * lanes);
+            return chunks * lanes / n;
+        }
+#endif
+    }
+
+    template<BitWidth bits, Signedness signedness>
+    class bigint;
+
+    // The width of a full product.
+    template<BitWidth bits>
+    inline constexpr auto double_width = BitWidth{2 * std::to_underlying(bits)};
+
+    template<BitWidth bits>
+    class montgomery_context;
+
+    template<BitWidth bits, Signedness signedness>
+    class ct_bigint;
+
+    // SlidingWindow is fast but its timing depends on the exponent. MontgomeryLadder performs the
+    // same sequence of operations and memory accesses for every exponent of a given width.
+    enum class PowMode : std::uint8_t {
+        SlidingWindow,
+        MontgomeryLadder
+    };
+
+    template<BitWidth bits, BitWidth exponent_bits, Signedness exponent_signedness>
+    constexpr bigint<bits, Signedness::Unsigned> pow_mod(bigint<bits, Signedness::Unsigned> const &base,
+                                                         bigint<exponent_bits, exponent_signedness> const &exponent,
+                                                         bigint<bits, Signedness::Unsigned> const &modulus,
+                                                         PowMode mode = PowMode::SlidingWindow);
+
+    template<BitWidth bits, Signedness signedness>
+    struct divmod_result {
+        bigint<bits, signedness> quotient;
+        bigint<bits, signedness> remainder;
+    };
+
+    template<BitWidth bits, Signedness signedness>
+    class bigint final {
+    private:
+        static_assert(std::to_underlying(bits) % CHAR_BIT == 0, "bits must be a multiple of CHAR_BIT");
+        static constexpr std::size_t limb_count = (std::to_underlying(bits) + detail::limb_bits - 1) / detail::limb_bits;
+        static constexpr std::size_t tail_bits = std::to_underlying(bits) % detail::limb_bits;
+        static constexpr detail::limb top_mask = tail_bits == 0
+                                                     ? ~detail::limb{0}
+                                                     : (detail::limb{1} << tail_bits) - 1;
+
+        // Limbs are kept in native order, so widths that are a multiple of 64 bits have the same
+        // object representation as a native integer. For any other width the most significant limb
+        // only holds the remaining bytes and its unused high bits are always zero. The storage is
+        // whole limbs, so sizeof is the width rounded up to 8 bytes: every loop reads and writes
+        // full aligned limbs instead of special-casing a byte tail.
+        std::array<detail::limb, limb_count> data_{};
+
+    public:
+        [[nodiscard]] constexpr bigint() = default;
+
+        template<std::integral T>
+        [[nodiscard]] constexpr bigint(T const data) {
+            assign_integral(data);
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        [[nodiscard]] constexpr bigint(bigint<other_bits, other_signedness> const &other) {
+            assign_extended(other);
+        }
+
+        [[nodiscard]] constexpr bigint(std::string_view const str) {
+            if (str.length() > 2 and str[0] == '0') {
+                switch (str[1]) {
+                    case 'x':
+                        init_from_string_base(str.substr(2), 16);
+                        break;
+                    case 'b':
+                        init_from_string_base(str.substr(2), 2);
+                        break;
+                    default:
+                        init_from_string_base(str.substr(1), 8);
+                        break;
+                }
+            } else {
+                if (str[0] == '-') {
+                    if constexpr (signedness == Signedness::Unsigned) {
+                        throw std::runtime_error("Cannot initialize an unsigned bigint23 with a negative value.");
+                    } else {
+                        init_from_string_base(str.substr(1), 10);
+                        *this = -*this;
+                    }
+                } else {
+                    init_from_string_base(str, 10);
+                }
+            }
+        }
+
+        template<std::size_t N>
+        [[nodiscard]] constexpr bigint(char const (&data)[N]) : bigint{std::string_view{data, N - 1}} {
+        }
+
+        [[nodiscard]] constexpr bigint(std::string const &str) : bigint{std::string_view{str}} {
+        }
+
+        // Copies are plain copies of the limbs; bigint stays trivially copyable.
+        constexpr bigint(bigint const &) = default;
+        constexpr bigint &operator=(bigint const &) = default;
+
+        template<std::integral T>
+        constexpr bigint &operator=(T const rhs) {
+            assign_integral(rhs);
+            return *this;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        constexpr bigint &operator=(bigint<other_bits, other_signedness> const &rhs) {
+            assign_extended(rhs);
+            return *this;
+        }
+
+        constexpr bigint &operator=(std::string_view const str) {
+            data_ = bigint{str}.data_;
+            return *this;
+        }
+
+        template<std::size_t N>
+        constexpr bigint &operator=(char const (&rhs)[N]) {
+            data_ = bigint{rhs}.data_;
+            return *this;
+        }
+
+        constexpr bigint &operator=(std::string const &rhs) {
+            data_ = bigint{rhs}.data_;
+            return *this;
+        }
+
+        template<std::integral T>
+        [[nodiscard]] constexpr std::strong_ordering operator<=>(T const other) const {
+            static_assert(std::to_underlying(bits) / CHAR_BIT >= sizeof(T),
+                          "Can't compare values with a larger bit count than the target type.");
+
+            return *this <=> bigint<BitWidth{sizeof(T) * CHAR_BIT}, std::is_signed_v<T>
+                                                                     ? Signedness::Signed
+                                                                     : Signedness::Unsigned>{other};
+        }
+
+        template<std::integral T>
+        [[nodiscard]] constexpr bool operator==(T const other) const {
+            static_assert(std::to_underlying(bits) / CHAR_BIT >= sizeof(T),
+                          "Can't compare values with a larger bit count than the target type.");
+            if constexpr (std::is_signed_v<T> and signedness == Signedness::Unsigned) {
+                if (other < 0) {
+                    return false;
+                }
+            }
+
+            return bigint{other}.data_ == data_;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        [[nodiscard]] constexpr std::strong_ordering operator
+        <=>(bigint<other_bits, other_signedness> const &other) const {
+            static constexpr auto max_count = std::max(limb_count, bigint<other_bits, other_signedness>::limb_count);
+
+            auto const lhs_negative = is_negative();
+            auto const rhs_negative = other.is_negative();
+            if (lhs_negative != rhs_negative) {
+                return lhs_negative ? std::strong_ordering::less : std::strong_ordering::greater;
+            }
+
+            for (auto const i: std::views::reverse(std::views::iota(0uz, max_count))) {
+                auto const lhs = extended_limb(i);
+                auto const rhs = other.extended_limb(i);
+                if (lhs != rhs) {
+                    return lhs < rhs ? std::strong_ordering::less : std::strong_ordering::greater;
+                }
+            }
+
+            return std::strong_ordering::equal;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        [[nodiscard]] constexpr bool operator==(bigint<other_bits, other_signedness> const &other) const {
+            if constexpr (bits < other_bits) {
+                return other == *this;
+            } else {
+                static_assert(bits >= other_bits, "Can't compare values with a larger bit count than the target type.");
+                if constexpr (other_signedness == Signedness::Signed and signedness == Signedness::Unsigned) {
+                    if (other.is_negative()) {
+                        return false;
+                    }
+                }
+
+                return bigint{other}.data_ == data_;
+            }
+        }
+
+        template<std::integral T>
+        constexpr bigint &operator+=(T const other) {
+            if constexpr (limb_operand<T>) {
+                if (negative_operand(other)) {
+                    subtract_limb(limb_magnitude(other));
+                } else {
+                    add_limb(limb_magnitude(other));
+                }
+            } else {
+                *this += bigint{other};
+            }
+            return *this;
         }
 
-        [[nodiscard]] constexpr bigint operator>>(std::size_t const shift) const {
+        template<std::integral T>
+        [[nodiscard]] constexpr bigint operator+(T const other) const {
             auto result = bigint{*this};
-            result >>= shift;
+            result += other;
             return result;
         }
 
-        [[nodiscard]] constexpr bigint operator+() const {
+        template<BitWidth other_bits, Signedness other_signedness>
+        constexpr bigint &operator+=(bigint<other_bits, other_signedness> const &other) {
+            auto const rhs = other.template extended_limbs<limb_count>();
+            auto carry = detail::limb{0};
+            for (auto const i: std::views::iota(0uz, limb_count)) {
+                limb(i) = detail::add_with_carry(limb(i), rhs[i], carry);
+            }
+            normalize();
             return *this;
         }
 
-        [[nodiscard]] constexpr bigint operator-() const {
-            auto min_value = bigint{};
-            if constexpr (std::endian::native == std::endian::little) {
-                min_value.data_.back() = 0x80;
+        template<BitWidth other_bits, Signedness other_signedness>
+        [[nodiscard]] constexpr bigint operator+(bigint<other_bits, other_signedness> const &other) const {
+            auto result = bigint{*this};
+            result += other;
+            return result;
+        }
+
+        template<std::integral T>
+        constexpr bigint &operator*=(T const other) {
+            if constexpr (limb_operand<T>) {
+                multiply_limb(limb_magnitude(other), negative_operand(other));
             } else {
-                min_value.data_.front() = 0x80;
+                *this *= bigint{other};
             }
+            return *this;
+        }
 
-            if (*this == min_value) {
-                throw std::overflow_error("Negation overflow: minimum value cannot be negated");
-            }
+        template<std::integral T>
+        [[nodiscard]] constexpr bigint operator*(T const other) const {
+            auto result = bigint{*this};
+            result *= other;
+            return result;
+        }
 
-            auto result = ~*this;
-            result += static_cast<std::int8_t>(1);
+        template<BitWidth other_bits, Signedness other_signedness>
+        constexpr bigint &operator*=(bigint<other_bits, other_signedness> const &other) {
+            // The low limb_count limbs of a two's complement product do not depend on the signs
+            // of the operands, so both sides are multiplied as sign-extended unsigned values.
+            auto result = std::array<detail::limb, limb_count>{};
+            detail::multiply(limbs(), other.template extended_limbs<limb_count>(), result);
+            assign_limbs(result);
+            return *this;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        [[nodiscard]] constexpr bigint operator*(bigint<other_bits, other_signedness> const &other) const {
+            auto result = bigint{*this};
+            result *= other;
             return result;
         }
 
-        constexpr bigint &operator++() {
-            *this += 1;
+        template<std::integral T>
+        constexpr bigint &operator-=(T const other) {
+            if constexpr (limb_operand<T>) {
+                if (negative_operand(other)) {
+                    add_limb(limb_magnitude(other));
+                } else {
+                    subtract_limb(limb_magnitude(other));
+                }
+            } else {
+                *this -= bigint{other};
+            }
             return *this;
         }
 
-        constexpr bigint operator++(int) {
+        template<std::integral T>
+        [[nodiscard]] constexpr bigint operator-(T const other) const {
             auto result = bigint{*this};
-            ++*this;
+            result -= other;
             return result;
         }
 
-        constexpr bigint &operator--() {
-            *this -= 1;
-            return *this;
+        template<BitWidth other_bits, Signedness other_signedness>
+        constexpr bigint &operator-=(bigint<other_bits, other_signedness> const &other) {
+            auto const rhs = other.template extended_limbs<limb_count>();
+            auto borrow = detail::limb{0};
+            for (auto const i: std::views::iota(0uz, limb_count)) {
+                limb(i) = detail::sub_with_borrow(limb(i), rhs[i], borrow);
+            }
+            normalize();
+            return *this;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        [[nodiscard]] constexpr bigint operator-(bigint<other_bits, other_signedness> const &other) const {
+            auto result = bigint{*this};
+            result -= other;
+            return result;
+        }
+
+        template<std::integral T>
+        constexpr bigint &operator/=(T const other) {
+            // An unsigned bigint divides by the two's complement of a negative operand, which is
+            // no single limb.
+            if constexpr (limb_operand<T>) {
+                if (signedness == Signedness::Signed or not negative_operand(other)) {
+                    auto remainder = bigint{};
+                    divide_limb(limb_magnitude(other), negative_operand(other), *this, remainder);
+                    return *this;
+                }
+            }
+            *this /= bigint{other};
+            return *this;
+        }
+
+        template<std::integral T>
+        [[nodiscard]] constexpr bigint operator/(T const other) const {
+            auto result = bigint{*this};
+            result /= other;
+            return result;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        constexpr bigint &operator/=(bigint<other_bits, other_signedness> const &other) {
+            auto remainder = bigint{};
+            divide(other, *this, remainder);
+            return *this;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        [[nodiscard]] constexpr bigint operator/(bigint<other_bits, other_signedness> const &other) const {
+            auto result = bigint{*this};
+            result /= other;
+            return result;
+        }
+
+        template<std::integral T>
+        constexpr bigint &operator%=(T const other) {
+            if constexpr (limb_operand<T>) {
+                if (signedness == Signedness::Signed or not negative_operand(other)) {
+                    auto quotient = bigint{};
+                    divide_limb(limb_magnitude(other), negative_operand(other), quotient, *this);
+                    return *this;
+                }
+            }
+            *this %= bigint{other};
+            return *this;
+        }
+
+        template<std::integral T>
+        [[nodiscard]] constexpr bigint operator%(T const other) const {
+            auto result = bigint{*this};
+            result %= other;
+            return result;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        constexpr bigint &operator%=(bigint<other_bits, other_signedness> const &other) {
+            auto quotient = bigint{};
+            divide(other, quotient, *this);
+            return *this;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        [[nodiscard]] constexpr bigint operator%(bigint<other_bits, other_signedness> const &other) const {
+            auto result = bigint{*this};
+            result %= other;
+            return result;
+        }
+
+        // Shifts by the width or more give zero (or all sign bits for >>) instead of being undefined.
+        constexpr bigint &operator<<=(std::size_t const shift) {
+            if (shift >= std::to_underlying(bits)) {
+                data_.fill(0);
+                return *this;
+            }
+
+            auto const limb_shift = std::size_t{shift / detail::limb_bits};
+            auto const bit_shift = std::size_t{shift % detail::limb_bits};
+
+            if (shift == 1) {
+                for (auto const i: std::views::reverse(std::views::iota(1uz, limb_count))) {
+                    limb(i) = detail::funnel_shift_left(limb(i), limb(i - 1), 1);
+                }
+            } else {
+                for (auto const i: std::views::reverse(std::views::iota(limb_shift + 1, limb_count))) {
+                    limb(i) = detail::funnel_shift_left(limb(i - limb_shift), limb(i - limb_shift - 1), bit_shift);
+                }
+            }
+            limb(limb_shift) = limb(0) << bit_shift;
+            for (auto const i: std::views::iota(0uz, limb_shift)) {
+                limb(i) = 0;
+            }
+            normalize();
+            return *this;
+        }
+
+        template<std::integral T>
+        constexpr bigint &operator<<=(T const shift) {
+            return *this <<= shift_count(shift);
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        constexpr bigint &operator<<=(bigint<other_bits, other_signedness> const &shift) {
+            return *this <<= shift_count(shift);
+        }
+
+        template<std::integral T>
+        [[nodiscard]] constexpr bigint operator<<(T const shift) const {
+            auto result = bigint{*this};
+            result <<= shift;
+            return result;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        [[nodiscard]] constexpr bigint operator<<(bigint<other_bits, other_signedness> const &shift) const {
+            auto result = bigint{*this};
+            result <<= shift;
+            return result;
+        }
+
+        constexpr bigint &operator>>=(std::size_t const shift) {
+            auto const fill = sign_fill();
+            if (shift >= std::to_underlying(bits)) {
+                data_.fill(fill);
+                normalize();
+                return *this;
+            }
+
+            auto const limb_shift = std::size_t{shift / detail::limb_bits};
+            auto const bit_shift = std::size_t{shift % detail::limb_bits};
+            auto const last = limb_count - 1 - limb_shift;
+
+            limb(limb_count - 1) = extended_limb(limb_count - 1);
+            if (shift == 1) {
+                for (auto const i: std::views::iota(0uz, last)) {
+                    limb(i) = detail::funnel_shift_right(limb(i + 1), limb(i), 1);
+                }
+            } else {
+                for (auto const i: std::views::iota(0uz, last)) {
+                    limb(i) = detail::funnel_shift_right(limb(i + limb_shift + 1), limb(i + limb_shift), bit_shift);
+                }
+            }
+            limb(last) = detail::funnel_shift_right(fill, limb(limb_count - 1), bit_shift);
+            for (auto const i: std::views::iota(last + 1, limb_count)) {
+                limb(i) = fill;
+            }
+            normalize();
+            return *this;
+        }
+
+        template<std::integral T>
+        constexpr bigint &operator>>=(T const shift) {
+            return *this >>= shift_count(shift);
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        constexpr bigint &operator>>=(bigint<other_bits, other_signedness> const &shift) {
+            return *this >>= shift_count(shift);
+        }
+
+        template<std::integral T>
+        [[nodiscard]] constexpr bigint operator>>(T const shift) const {
+            auto result = bigint{*this};
+            result >>= shift;
+            return result;
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        [[nodiscard]] constexpr bigint operator>>(bigint<other_bits, other_signedness> const &shift) const {
+            auto result = bigint{*this};
+            result >>= shift;
+            return result;
+        }
+
+        [[nodiscard]] constexpr bigint operator+() const {
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bigint operator-() const {
+            auto min_value = bigint{};
+            min_value.set_bit(std::to_underlying(bits) - 1, true);
+
+            if (*this == min_value) {
+                throw std::overflow_error("Negation overflow: minimum value cannot be negated");
+            }
+
+            auto result = ~*this;
+            result += static_cast<std::int8_t>(1);
+            return result;
+        }
+
+        constexpr bigint &operator++() {
+            *this += 1;
+            return *this;
+        }
+
+        constexpr bigint operator++(int) {
+            auto result = bigint{*this};
+            ++*this;
+            return result;
+        }
+
+        constexpr bigint &operator--() {
+            *this -= 1;
+            return *this;
+        }
+
+        constexpr bigint operator--(int) {
+            auto result = bigint{*this};
+            --*this;
+            return result;
+        }
+
+        [[nodiscard]] constexpr bigint operator&(bigint const &other) const {
+            auto result = bigint{*this};
+            result &= other;
+            return result;
+        }
+
+        constexpr bigint &operator&=(bigint const &other) {
+            for (auto const i: std::views::iota(0uz, data_.size())) {
+                data_[i] &= other.data_[i];
+            }
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bigint operator|(bigint const &other) const {
+            auto result = bigint{*this};
+            result |= other;
+            return result;
+        }
+
+        constexpr bigint &operator|=(bigint const &other) {
+            for (auto const i: std::views::iota(0uz, data_.size())) {
+                data_[i] |= other.data_[i];
+            }
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bigint operator^(bigint const &other) const {
+            auto result = bigint{*this};
+            result ^= other;
+            return result;
+        }
+
+        constexpr bigint &operator^=(bigint const &other) {
+            for (auto const i: std::views::iota(0uz, data_.size())) {
+                data_[i] ^= other.data_[i];
+            }
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bigint operator~() const {
+            auto result = bigint{*this};
+            for (auto &value: result.data_) {
+                value = ~value;
+            }
+            result.normalize();
+            return result;
+        }
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend class bigint;
+
+        template<BitWidth other_bits>
+        friend class montgomery_context;
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend class ct_bigint;
+
+        friend struct detail::limb_access;
+
+#ifndef bigint_DISABLE_IO
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend constexpr std::ostream &print_hex(std::ostream &, bigint<other_bits, other_is_signed> const &, bool);
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend constexpr std::ostream &print_oct(std::ostream &, bigint<other_bits, other_is_signed> const &);
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend constexpr std::ostream &print_dec(std::ostream &, bigint<other_bits, other_is_signed> const &);
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend constexpr std::ostream &operator<<(std::ostream &, bigint<other_bits, other_is_signed> const &);
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend constexpr std::istream &operator>>(std::istream &, bigint<other_bits, other_is_signed> &);
+#endif
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend constexpr std::to_chars_result to_chars(char *, char *, bigint<other_bits, other_is_signed> const &, int);
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend constexpr std::from_chars_result from_chars(char const *, char const *, bigint<other_bits, other_is_signed> &,
+                                                           int);
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend constexpr bigint<other_bits, other_is_signed> byteswap(bigint<other_bits, other_is_signed> const &);
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend constexpr bigint<double_width<other_bits>, other_is_signed> wide_multiply(
+            bigint<other_bits, other_is_signed> const &, bigint<other_bits, other_is_signed> const &);
+
+        template<BitWidth other_bits, Signedness other_is_signed>
+        friend constexpr bigint<other_bits, other_is_signed> mul_hi(bigint<other_bits, other_is_signed> const &,
+                                                                    bigint<other_bits, other_is_signed> const &);
+
+        template<BitWidth lhs_bits, Signedness lhs_is_signed, BitWidth rhs_bits, Signedness rhs_is_signed>
+        friend constexpr divmod_result<lhs_bits, lhs_is_signed> divmod(bigint<lhs_bits, lhs_is_signed> const &,
+                                                                      bigint<rhs_bits, rhs_is_signed> const &);
+
+        template<BitWidth other_bits, Signedness other_is_signed, std::integral T>
+        friend constexpr divmod_result<other_bits, other_is_signed> divmod(bigint<other_bits, other_is_signed> const &,
+                                                                          T);
+
+        template<BitWidth other_bits, BitWidth exponent_bits, Signedness exponent_signedness>
+        friend constexpr bigint<other_bits, Signedness::Unsigned> pow_mod(
+            bigint<other_bits, Signedness::Unsigned> const &, bigint<exponent_bits, exponent_signedness> const &,
+            bigint<other_bits, Signedness::Unsigned> const &, PowMode);
+
+    private:
+        [[nodiscard]] constexpr detail::limb limb(std::size_t const index) const {
+            if constexpr (std::endian::native == std::endian::little) {
+                return data_[index];
+            } else {
+                return data_[limb_count - 1 - index];
+            }
+        }
+
+        [[nodiscard]] constexpr detail::limb &limb(std::size_t const index) {
+            if constexpr (std::endian::native == std::endian::little) {
+                return data_[index];
+            } else {
+                return data_[limb_count - 1 - index];
+            }
+        }
+
+        [[nodiscard]] constexpr std::array<detail::limb, limb_count> limbs() const {
+            auto result = std::array<detail::limb, limb_count>{};
+            for (auto const i: std::views::iota(0uz, limb_count)) {
+                result[i] = limb(i);
+            }
+            return result;
+        }
+
+        template<std::size_t n>
+        constexpr void assign_limbs(std::array<detail::limb, n> const &value) {
+            for (auto const i: std::views::iota(0uz, limb_count)) {
+                limb(i) = i < n ? value[i] : 0;
+            }
+            normalize();
+        }
+
+        constexpr void normalize() {
+            if constexpr (tail_bits != 0) {
+                limb(limb_count - 1) &= top_mask;
+            }
+        }
+
+        template<std::integral T>
+        constexpr void assign_integral(T const data) {
+            static_assert(std::to_underlying(bits) / CHAR_BIT >= sizeof(T),
+                          "Can't assign values with a larger bit count than the target type.");
+
+            auto fill = detail::limb{0};
+            if constexpr (std::is_signed_v<T>) {
+                fill = (data < 0 ? ~detail::limb{0} : 0);
+            }
+            data_.fill(fill);
+
+            if constexpr (sizeof(T) <= sizeof(detail::limb)) {
+                limb(0) = static_cast<detail::limb>(data);
+            } else {
+                auto value = static_cast<std::make_unsigned_t<T>>(data);
+                for (auto const i: std::views::iota(0uz, sizeof(T) / sizeof(detail::limb))) {
+                    limb(i) = static_cast<detail::limb>(value);
+                    value >>= detail::limb_bits;
+                }
+            }
+            normalize();
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        constexpr void assign_extended(bigint<other_bits, other_signedness> const &other) {
+            static_assert(bits >= other_bits, "Can't assign values with a larger bit count than the target type.");
+
+            for (auto const i: std::views::iota(0uz, limb_count)) {
+                limb(i) = other.extended_limb(i);
+            }
+            normalize();
+        }
+
+        // Built-in operands of at most one limb take the single limb paths below instead of being
+        // widened to a bigint first. Narrow bigints keep the widening, which also checks the size.
+        template<std::integral T>
+        static constexpr bool limb_operand = sizeof(T) <= sizeof(detail::limb) and
+                                             std::to_underlying(bits) > detail::limb_bits;
+
+        template<std::integral T>
+        [[nodiscard]] static constexpr bool negative_operand(T const value) {
+            if constexpr (std::is_signed_v<T>) {
+                return value < 0;
+            } else {
+                return false;
+            }
+        }
+
+        template<std::integral T>
+        [[nodiscard]] static constexpr detail::limb limb_magnitude(T const value) {
+            if (negative_operand(value)) {
+                return detail::limb{0} - static_cast<detail::limb>(value);
+            }
+            return static_cast<detail::limb>(value);
+        }
+
+        // Adding or subtracting a single limb stops at the first limb that leaves no carry.
+        constexpr void add_limb(detail::limb const value) {
+            auto carry = value;
+            for (auto i = 0uz; i < limb_count and carry != 0; ++i) {
+                limb(i) += carry;
+                carry = limb(i) < carry;
+            }
+            normalize();
+        }
+
+        constexpr void subtract_limb(detail::limb const value) {
+            auto borrow = value;
+            for (auto i = 0uz; i < limb_count and borrow != 0; ++i) {
+                auto const current = limb(i);
+                limb(i) = current - borrow;
+                borrow = current < borrow;
+            }
+            normalize();
+        }
+
+        // Multiplies by a single limb and negates the result for a negative operand, wrapping like
+        // the full multiplication.
+        constexpr void multiply_limb(detail::limb const value, bool const negative) {
+            auto carry = detail::limb{0};
+            for (auto const i: std::views::iota(0uz, limb_count)) {
+                auto high = detail::limb{0};
+                auto const low = detail::multiply_wide(limb(i), value, high);
+                limb(i) = low + carry;
+                carry = high + (limb(i) < low);
+            }
+            if (negative) {
+                auto borrow = detail::limb{0};
+                for (auto const i: std::views::iota(0uz, limb_count)) {
+                    limb(i) = detail::sub_with_borrow(0, limb(i), borrow);
+                }
+            }
+            normalize();
+        }
+
+        // Truncating division by a divisor given as a single limb magnitude and its sign; quotient
+        // and remainder may alias *this.
+        constexpr void divide_limb(detail::limb const divisor, bool const negative_divisor, bigint &quotient,
+                                   bigint &remainder) const {
+            if (divisor == 0) {
+                throw std::overflow_error("Division by zero");
+            }
+
+            auto const negative_dividend = is_negative();
+            auto value = magnitude<limb_count>();
+            auto const size = detail::significant_limbs(value);
+            auto rest = std::array<detail::limb, limb_count>{};
+            rest[0] = size >= detail::reciprocal_division_threshold
+                          ? detail::divide_in_place(value, size, detail::make_reciprocal(divisor))
+                          : detail::divide_in_place(value, size, divisor);
+            if (negative_dividend != negative_divisor) {
+                detail::negate(value);
+            }
+            if (negative_dividend) {
+                detail::negate(rest);
+            }
+            quotient.assign_limbs(value);
+            remainder.assign_limbs(rest);
+        }
+
+        // Shift counts of any type as a std::size_t, where every count from the width on is the same.
+        template<std::integral T>
+        [[nodiscard]] static constexpr std::size_t shift_count(T const shift) {
+            if constexpr (std::is_signed_v<T>) {
+                if (shift < 0) {
+                    throw std::invalid_argument("Shift count must not be negative.");
+                }
+            }
+            if constexpr (sizeof(T) > sizeof(std::size_t)) {
+                if (shift >= static_cast<T>(std::to_underlying(bits))) {
+                    return std::to_underlying(bits);
+                }
+            }
+            return static_cast<std::size_t>(shift);
+        }
+
+        template<BitWidth other_bits, Signedness other_signedness>
+        [[nodiscard]] static constexpr std::size_t shift_count(bigint<other_bits, other_signedness> const &shift) {
+            if (shift.is_negative()) {
+                throw std::invalid_argument("Shift count must not be negative.");
+            }
+            for (auto const i: std::views::iota(1uz, shift.limb_count)) {
+                if (shift.limb(i) != 0) {
+                    return std::to_underlying(bits);
+                }
+            }
+            return static_cast<std::size_t>(std::min(shift.limb(0), detail::limb{std::to_underlying(bits)}));
+        }
+
+        [[nodiscard]] constexpr bool is_negative() const {
+            if constexpr (signedness == Signedness::Signed) {
+                return get_bit(std::to_underlying(bits) - 1);
+            } else {
+                return false;
+            }
+        }
+
+        [[nodiscard]] constexpr detail::limb sign_fill() const {
+            return is_negative() ? ~detail::limb{0} : 0;
+        }
+
+        // Returns the limb at index as if the value was sign extended to an unlimited width.
+        [[nodiscard]] constexpr detail::limb extended_limb(std::size_t const index) const {
+            if (index >= limb_count) {
+                return sign_fill();
+            }
+            if constexpr (tail_bits != 0) {
+                if (index == limb_count - 1) {
+                    return limb(index) | (sign_fill() & ~top_mask);
+                }
+            }
+            return limb(index);
+        }
+
+        // Returns the value sign extended or truncated to n little-endian limbs.
+        template<std::size_t n>
+        [[nodiscard]] constexpr std::array<detail::limb, n> extended_limbs() const {
+            auto result = std::array<detail::limb, n>{};
+            for (auto const i: std::views::iota(0uz, n)) {
+                result[i] = extended_limb(i);
+            }
+            return result;
+        }
+
+        // Returns the absolute value as n little-endian limbs.
+        template<std::size_t n>
+        [[nodiscard]] constexpr std::array<detail::limb, n> magnitude() const {
+            auto result = extended_limbs<n>();
+            if (is_negative()) {
+                detail::negate(result);
+            }
+            return result;
+        }
+
+        // Truncating division; quotient and remainder may alias *this.
+        template<BitWidth other_bits, Signedness other_signedness>
+        constexpr void divide(bigint<other_bits, other_signedness> const &other, bigint &quotient,
+                              bigint &remainder) const {
+            if (other == std::int8_t{0}) {
+                throw std::overflow_error("Division by zero");
+            }
+
+            static constexpr auto n = std::max(limb_count, bigint<other_bits, other_signedness>::limb_count);
+            auto const negative_dividend = is_negative();
+            auto const negative_quotient = negative_dividend != other.is_negative();
+            auto quotient_limbs = std::array<detail::limb, n>{};
+            auto remainder_limbs = std::array<detail::limb, n>{};
+            detail::divide(magnitude<n>(), other.template magnitude<n>(), quotient_limbs, remainder_limbs);
+            if (negative_quotient) {
+                detail::negate(quotient_limbs);
+            }
+            if (negative_dividend) {
+                detail::negate(remainder_limbs);
+            }
+            quotient.assign_limbs(quotient_limbs);
+            remainder.assign_limbs(remainder_limbs);
+        }
+
+        [[nodiscard]] constexpr bool get_bit(std::size_t const pos) const {
+            return (limb(pos / detail::limb_bits) >> (pos % detail::limb_bits)) & 1;
+        }
+
+        constexpr void set_bit(std::size_t const pos, bool const value) {
+            auto const mask = detail::limb{detail::limb{1} << (pos % detail::limb_bits)};
+            if (value) {
+                limb(pos / detail::limb_bits) |= mask;
+            } else {
+                limb(pos / detail::limb_bits) &= ~mask;
+            }
+        }
+
+        constexpr void init_from_string_base(std::string_view const str, std::uint32_t const base) {
+            auto value = std::array<detail::limb, limb_count>{};
+            auto const error = std::has_single_bit(base)
+                                   ? detail::parse_separated_power_of_two(
+                                       str, static_cast<std::size_t>(std::countr_zero(base)), value)
+                                   : detail::parse_separated(str, base, value);
+            switch (error) {
+                case detail::parse_error::invalid_digit:
+                    throw std::runtime_error("Invalid digit in input string.");
+                case detail::parse_error::digit_out_of_range:
+                    throw std::runtime_error("Digit out of range for base.");
+                case detail::parse_error::overflow:
+                    throw std::overflow_error("Overflow while parsing the input string.");
+                case detail::parse_error::none:
+                    break;
+            }
+            if constexpr (tail_bits != 0) {
+                if ((value[limb_count - 1] & ~top_mask) != 0) {
+                    throw std::overflow_error("Overflow while parsing the input string.");
+                }
+            }
+            assign_limbs(value);
+        }
+    };
+
+    // Returns the full product in twice the width, so it never overflows.
+    template<BitWidth bits, Signedness signedness>
+    constexpr bigint<double_width<bits>, signedness> wide_multiply(
+        bigint<bits, signedness> const &lhs, bigint<bits, signedness> const &rhs) {
+        constexpr auto n = bigint<bits, signedness>::limb_count;
+        auto product = std::array<detail::limb, 2 * n>{};
+        detail::multiply_full(lhs.template magnitude<n>(), rhs.template magnitude<n>(), product);
+        if (lhs.is_negative() != rhs.is_negative()) {
+            detail::negate(product);
+        }
+        auto result = bigint<double_width<bits>, signedness>{};
+        result.assign_limbs(product);
+        return result;
+    }
+
+    // Returns the upper half of the full product, the counterpart of the truncating operator*.
+    template<BitWidth bits, Signedness signedness>
+    constexpr bigint<bits, signedness> mul_hi(bigint<bits, signedness> const &lhs, bigint<bits, signedness> const &rhs) {
+        auto const high = wide_multiply(lhs, rhs) >> std::to_underlying(bits);
+        auto result = bigint<bits, signedness>{};
+        result.assign_limbs(high.template extended_limbs<bigint<bits, signedness>::limb_count>());
+        return result;
+    }
+
+    // Computes quotient and remainder in a single division. Like operator/ and operator% the
+    // quotient is truncated towards zero and the remainder has the sign of the dividend.
+    template<BitWidth bits, Signedness signedness, BitWidth other_bits, Signedness other_signedness>
+    constexpr divmod_result<bits, signedness> divmod(bigint<bits, signedness> const &dividend,
+                                                     bigint<other_bits, other_signedness> const &divisor) {
+        auto result = divmod_result<bits, signedness>{};
+        dividend.divide(divisor, result.quotient, result.remainder);
+        return result;
+    }
+
+    template<BitWidth bits, Signedness signedness, std::integral T>
+    constexpr divmod_result<bits, signedness> divmod(bigint<bits, signedness> const &dividend, T const divisor) {
+        using value_type = bigint<bits, signedness>;
+        // Like operator/ an unsigned dividend divides by the two's complement of a negative
+        // divisor, which is no single limb.
+        if constexpr (value_type::template limb_operand<T>) {
+            if (signedness == Signedness::Signed or not value_type::negative_operand(divisor)) {
+                auto result = divmod_result<bits, signedness>{};
+                dividend.divide_limb(value_type::limb_magnitude(divisor), value_type::negative_operand(divisor),
+                                     result.quotient, result.remainder);
+                return result;
+            }
+        }
+        if constexpr (signedness == Signedness::Unsigned and std::is_signed_v<T> and
+                      std::to_underlying(bits) / CHAR_BIT >= sizeof(T)) {
+            if (divisor < 0) {
+                return divmod(dividend, value_type{divisor});
+            }
+        }
+        return divmod(dividend, bigint<BitWidth{sizeof(T) * CHAR_BIT}, std::is_signed_v<T>
+                                                                       ? Signedness::Signed
+                                                                       : Signedness::Unsigned>{divisor});
+    }
+
+    // Floored division: the quotient is rounded towards negative infinity and the remainder has
+    // the sign of the divisor.
+    template<BitWidth bits, Signedness signedness, typename Divisor>
+    constexpr divmod_result<bits, signedness> divmod_floor(bigint<bits, signedness> const &dividend,
+                                                           Divisor const &divisor) {
+        auto result = divmod(dividend, divisor);
+        if constexpr (signedness == Signedness::Signed) {
+            auto negative_divisor = false;
+            if constexpr (std::integral<Divisor>) {
+                negative_divisor = std::cmp_less(divisor, 0);
+            } else {
+                negative_divisor = divisor < std::int8_t{0};
+            }
+            if (result.remainder != std::int8_t{0} and (result.remainder < std::int8_t{0}) != negative_divisor) {
+                --result.quotient;
+                result.remainder += divisor;
+            }
+        }
+        return result;
+    }
+
+    // Writes value in the given base (2 to 36) with lowercase digits and a leading '-' for negative
+    // values, following the rules of std::to_chars. Never throws and never allocates.
+    template<BitWidth bits, Signedness signedness>
+    constexpr std::to_chars_result to_chars(char *first, char *last, bigint<bits, signedness> const &value,
+                                            int const base = 10) {
+        using type = bigint<bits, signedness>;
+        if (base < 2 or base > 36) {
+            return {last, std::errc::invalid_argument};
+        }
+        if (value.is_negative()) {
+            if (first == last) {
+                return {last, std::errc::value_too_large};
+            }
+            *first++ = '-';
+        }
+
+        auto const magnitude = value.template magnitude<type::limb_count>();
+        auto const size = detail::significant_limbs(magnitude);
+        if (size == 0) {
+            if (first == last) {
+                return {last, std::errc::value_too_large};
+            }
+            *first = '0';
+            return {first + 1, std::errc{}};
+        }
+
+        // Every digit covers at least bit_width(base) - 1 bits, which bounds the number of digits.
+        auto const radix = static_cast<detail::limb>(base);
+        auto const bit_count = (size - 1) * detail::limb_bits + static_cast<std::size_t>(std::bit_width(magnitude[size - 1]));
+        auto const digit_bits = static_cast<std::size_t>(std::bit_width(radix)) - 1;
+        auto const max_digits = (bit_count + digit_bits - 1) / digit_bits;
+        auto const available = static_cast<std::size_t>(last - first);
+        if (available >= max_digits) {
+            auto const start = detail::format_radix(magnitude, last, radix);
+            if (start != first) {
+                std::copy(start, last, first);
+            }
+            return {first + (last - start), std::errc{}};
+        }
+        if (std::has_single_bit(radix)) {
+            return {last, std::errc::value_too_large};
+        }
+
+        // Bases other than powers of two need at most log3(2) < 2/3 digits per bit.
+        auto buffer = std::array<char, std::to_underlying(bits) * 2 / 3 + 2>{};
+        auto const end = buffer.data() + buffer.size();
+        auto const start = detail::format_radix(magnitude, end, radix);
+        if (static_cast<std::size_t>(end - start) > available) {
+            return {last, std::errc::value_too_large};
+        }
+        return {std::copy(start, end, first), std::errc{}};
+    }
+
+    // Parses digits in the given base (2 to 36) following the rules of std::from_chars: no prefix,
+    // no whitespace and a '-' only for signed types. value is left untouched on error.
+    template<BitWidth bits, Signedness signedness>
+    constexpr std::from_chars_result from_chars(char const *first, char const *last, bigint<bits, signedness> &value,
+                                                int const base = 10) {
+        using type = bigint<bits, signedness>;
+        if (base < 2 or base > 36) {
+            return {first, std::errc::invalid_argument};
+        }
+        auto const negative = signedness == Signedness::Signed and first != last and *first == '-';
+        auto const digits = negative ? first + 1 : first;
+
+        auto magnitude = std::array<detail::limb, type::limb_count>{};
+        auto const [ptr, overflow] = detail::parse_digits(digits, last, static_cast<detail::limb>(base), magnitude);
+        if (ptr == digits) {
+            return {first, std::errc::invalid_argument};
+        }
+
+        auto out_of_range = overflow;
+        if constexpr (type::tail_bits != 0) {
+            out_of_range = out_of_range or (magnitude[type::limb_count - 1] & ~type::top_mask) != 0;
+        }
+        if constexpr (signedness == Signedness::Signed) {
+            // The magnitude may reach 2^(bits - 1) only for negative values.
+            constexpr auto sign_bit = std::size_t{std::to_underlying(bits) - 1};
+            auto limit = std::array<detail::limb, type::limb_count>{};
+            limit[sign_bit / detail::limb_bits] = detail::limb{1} << (sign_bit % detail::limb_bits);
+            auto const order = detail::compare(magnitude, limit);
+            out_of_range = out_of_range or order > 0 or (order == 0 and not negative);
+        }
+        if (out_of_range) {
+            return {ptr, std::errc::result_out_of_range};
+        }
+
+        if (negative) {
+            detail::negate(magnitude);
+        }
+        value.assign_limbs(magnitude);
+        return {ptr, std::errc{}};
+    }
+
+    // Montgomery arithmetic modulo an odd modulus m with R = 2^(64 * limbs). Values are converted
+    // with to_mont, multiplied and squared in Montgomery form, and converted back with from_mont.
+    template<BitWidth bits>
+    class montgomery_context final {
+    public:
+        using value_type = bigint<bits, Signedness::Unsigned>;
+
+        [[nodiscard]] constexpr explicit montgomery_context(value_type const &modulus) : modulus_{modulus.limbs()} {
+            if ((modulus_[0] & 1) == 0) {
+                throw std::invalid_argument("Montgomery modulus must be odd.");
+            }
+
+            // Newton iteration doubles the number of correct low bits, starting from three.
+            auto inverse = modulus_[0];
+            for (auto i = 0; i < 5; ++i) {
+                inverse *= 2 - modulus_[0] * inverse;
+            }
+            inverse_ = 0 - inverse;
+
+            auto power = std::array<detail::limb, 2 * n + 1>{};
+            power[2 * n] = 1;
+            auto quotient = std::array<detail::limb, 2 * n + 1>{};
+            auto remainder = std::array<detail::limb, 2 * n + 1>{};
+            detail::divide(power, detail::slice<2 * n + 1>(modulus_), quotient, remainder);
+            r2_ = detail::slice<n>(remainder);
+            one_ = detail::montgomery_reduce(detail::slice<2 * n>(r2_), modulus_, inverse_);
+        }
+
+        [[nodiscard]] constexpr value_type modulus() const {
+            return make(modulus_);
+        }
+
+        // The Montgomery form of one, R mod m.
+        [[nodiscard]] constexpr value_type one() const {
+            return make(one_);
+        }
+
+        // Converts value, reduced modulo m first, to Montgomery form value * R mod m.
+        [[nodiscard]] constexpr value_type to_mont(value_type const &value) const {
+            auto limbs = value.limbs();
+            if (detail::compare(limbs, modulus_) >= 0) {
+                auto quotient = std::array<detail::limb, n>{};
+                auto remainder = std::array<detail::limb, n>{};
+                detail::divide(limbs, modulus_, quotient, remainder);
+                limbs = remainder;
+            }
+            return make(multiply(limbs, r2_));
+        }
+
+        [[nodiscard]] constexpr value_type from_mont(value_type const &value) const {
+            return make(detail::montgomery_reduce(detail::slice<2 * n>(value.limbs()), modulus_, inverse_));
+        }
+
+        // Both arguments must be in Montgomery form and less than m.
+        [[nodiscard]] constexpr value_type mul(value_type const &lhs, value_type const &rhs) const {
+            return make(multiply(lhs.limbs(), rhs.limbs()));
+        }
+
+        [[nodiscard]] constexpr value_type sqr(value_type const &value) const {
+            return make(square(value.limbs()));
+        }
+
+        // Raises base, in Montgomery form, to a non-negative exponent and returns the result in
+        // Montgomery form.
+        template<BitWidth exponent_bits, Signedness exponent_signedness>
+        [[nodiscard]] constexpr value_type pow(value_type const &base,
+                                               bigint<exponent_bits, exponent_signedness> const &exponent,
+                                               PowMode const mode = PowMode::SlidingWindow) const {
+            if (exponent.is_negative()) {
+                throw std::invalid_argument("Exponent must not be negative.");
+            }
+            if (mode == PowMode::MontgomeryLadder) {
+                return make(ladder(base.limbs(), exponent));
+            }
+            return make(sliding_window(base.limbs(), exponent));
+        }
+
+    private:
+        static constexpr std::size_t n = value_type::limb_count;
+
+        std::array<detail::limb, n> modulus_{};
+        std::array<detail::limb, n> r2_{};
+        std::array<detail::limb, n> one_{};
+        detail::limb inverse_{};
+
+        [[nodiscard]] constexpr std::array<detail::limb, n> multiply(std::array<detail::limb, n> const &lhs,
+                                                                     std::array<detail::limb, n> const &rhs) const {
+            auto product = std::array<detail::limb, 2 * n>{};
+            detail::multiply_full(lhs, rhs, product);
+            return detail::montgomery_reduce(product, modulus_, inverse_);
+        }
+
+        [[nodiscard]] constexpr std::array<detail::limb, n> square(std::array<detail::limb, n> const &value) const {
+            auto product = std::array<detail::limb, 2 * n>{};
+            detail::square_full(value, product);
+            return detail::montgomery_reduce(product, modulus_, inverse_);
+        }
+
+        // Left-to-right sliding window over the odd powers base^1, base^3, ..., base^(2^w - 1).
+        template<BitWidth exponent_bits, Signedness exponent_signedness>
+        [[nodiscard]] constexpr std::array<detail::limb, n> sliding_window(
+            std::array<detail::limb, n> const &base, bigint<exponent_bits, exponent_signedness> const &exponent) const {
+            auto const exponent_limbs = exponent.limbs();
+            auto const size = detail::significant_limbs(exponent_limbs);
+            if (size == 0) {
+                return one_;
+            }
+            auto const length = (size - 1) * detail::limb_bits +
+                                static_cast<std::size_t>(std::bit_width(exponent_limbs[size - 1]));
+            auto const window = length > 671 ? 6uz : length > 239 ? 5uz : length > 79 ? 4uz : length > 23 ? 3uz : 1uz;
+
+            auto powers = std::array<std::array<detail::limb, n>, 32>{};
+            powers[0] = base;
+            auto const base_squared = square(base);
+            for (auto const i: std::views::iota(1uz, 1uz << (window - 1))) {
+                powers[i] = multiply(powers[i - 1], base_squared);
+            }
+
+            auto result = one_;
+            auto position = length;
+            while (position > 0) {
+                if (not exponent.get_bit(position - 1)) {
+                    result = square(result);
+                    --position;
+                    continue;
+                }
+                auto low = position > window ? position - window : 0;
+                while (not exponent.get_bit(low)) {
+                    ++low;
+                }
+                auto value = std::size_t{0};
+                for (auto const bit: std::views::reverse(std::views::iota(low, position))) {
+                    result = square(result);
+                    value = (value << 1) | static_cast<std::size_t>(exponent.get_bit(bit));
+                }
+                result = multiply(result, powers[value >> 1]);
+                position = low;
+            }
+            return result;
+        }
+
+        // Montgomery ladder over every bit of the exponent's width. Both registers are updated in
+        // each step and swapped with masks, so neither control flow nor memory access depend on
+        // the exponent.
+        template<BitWidth exponent_bits, Signedness exponent_signedness>
+        [[nodiscard]] constexpr std::array<detail::limb, n> ladder(
+            std::array<detail::limb, n> const &base, bigint<exponent_bits, exponent_signedness> const &exponent) const {
+            auto low = one_;
+            auto high = base;
+            for (auto const bit: std::views::reverse(std::views::iota(0uz, std::to_underlying(exponent_bits)))) {
+                auto const condition = static_cast<detail::limb>(exponent.get_bit(bit));
+                detail::conditional_swap(low, high, condition);
+                high = multiply_constant_time(low, high);
+                low = square_constant_time(low);
+                detail::conditional_swap(low, high, condition);
+            }
+            return low;
+        }
+
+        [[nodiscard]] constexpr std::array<detail::limb, n> multiply_constant_time(
+            std::array<detail::limb, n> const &lhs, std::array<detail::limb, n> const &rhs) const {
+            auto product = std::array<detail::limb, 2 * n>{};
+            detail::multiply_schoolbook(lhs, rhs, product);
+            return detail::montgomery_reduce(product, modulus_, inverse_);
+        }
+
+        [[nodiscard]] constexpr std::array<detail::limb, n> square_constant_time(
+            std::array<detail::limb, n> const &value) const {
+            auto product = std::array<detail::limb, 2 * n>{};
+            detail::square_schoolbook(value, product);
+            return detail::montgomery_reduce(product, modulus_, inverse_);
+        }
+
+        [[nodiscard]] static constexpr value_type make(std::array<detail::limb, n> const &limbs) {
+            auto result = value_type{};
+            result.assign_limbs(limbs);
+            return result;
+        }
+    };
+
+    // Computes base^exponent mod modulus. Odd moduli use Montgomery arithmetic in the requested
+    // mode. Even moduli fall back to square-and-multiply with a division per step, which has no
+    // constant-time variant, so MontgomeryLadder rejects them.
+    template<BitWidth bits, BitWidth exponent_bits, Signedness exponent_signedness>
+    constexpr bigint<bits, Signedness::Unsigned> pow_mod(bigint<bits, Signedness::Unsigned> const &base,
+                                                         bigint<exponent_bits, exponent_signedness> const &exponent,
+                                                         bigint<bits, Signedness::Unsigned> const &modulus,
+                                                         PowMode const mode) {
+        using value_type = bigint<bits, Signedness::Unsigned>;
+        if (modulus == 0) {
+            throw std::overflow_error("Division by zero");
+        }
+        if (exponent.is_negative()) {
+            throw std::invalid_argument("Exponent must not be negative.");
+        }
+        if (modulus.get_bit(0)) {
+            auto const context = montgomery_context<bits>{modulus};
+            return context.from_mont(context.pow(context.to_mont(base), exponent, mode));
+        }
+        if (mode == PowMode::MontgomeryLadder) {
+            throw std::invalid_argument("Constant-time exponentiation requires an odd modulus.");
+        }
+
+        auto const wide_modulus = bigint<double_width<bits>, Signedness::Unsigned>{modulus};
+        auto const multiply = [&wide_modulus](value_type const &lhs, value_type const &rhs) {
+            auto const remainder = wide_multiply(lhs, rhs) % wide_modulus;
+            auto result = value_type{};
+            result.assign_limbs(remainder.limbs());
+            return result;
+        };
+        auto const exponent_limbs = exponent.limbs();
+        auto const size = detail::significant_limbs(exponent_limbs);
+        auto const length = size == 0 ? 0uz
+                                      : (size - 1) * detail::limb_bits +
+                                            static_cast<std::size_t>(std::bit_width(exponent_limbs[size - 1]));
+        auto result = value_type{1} % modulus;
+        auto const reduced = base % modulus;
+        for (auto const bit: std::views::reverse(std::views::iota(0uz, length))) {
+            result = multiply(result, result);
+            if (exponent.get_bit(bit)) {
+                result = multiply(result, reduced);
+            }
+        }
+        return result;
+    }
+
+    // A bigint whose comparison, selection, arithmetic and division run with control flow and
+    // memory accesses that only depend on the width, for use with secret values. Shift amounts are
+    // treated as public. Negation and signed division wrap like two's complement instead of
+    // throwing; dividing by zero still throws, which only reveals that the divisor is zero.
+    template<BitWidth bits, Signedness signedness>
+    class ct_bigint final {
+    public:
+        using value_type = bigint<bits, signedness>;
+
+        [[nodiscard]] constexpr ct_bigint() = default;
+
+        [[nodiscard]] constexpr ct_bigint(value_type const &value) : value_{value} {
+        }
+
+        template<std::integral T>
+        [[nodiscard]] constexpr ct_bigint(T const value) : value_{value} {
+        }
+
+        [[nodiscard]] constexpr value_type const &value() const {
+            return value_;
+        }
+
+        // Returns lhs if condition is true and rhs otherwise.
+        [[nodiscard]] static constexpr ct_bigint select(bool const condition, ct_bigint const &lhs,
+                                                        ct_bigint const &rhs) {
+            return make(detail::select(static_cast<detail::limb>(condition), lhs.limbs(), rhs.limbs()));
+        }
+
+        friend constexpr void conditional_swap(bool const condition, ct_bigint &lhs, ct_bigint &rhs) {
+            auto lhs_limbs = lhs.limbs();
+            auto rhs_limbs = rhs.limbs();
+            detail::conditional_swap(lhs_limbs, rhs_limbs, static_cast<detail::limb>(condition));
+            lhs.assign_limbs(lhs_limbs);
+            rhs.assign_limbs(rhs_limbs);
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(ct_bigint const &lhs, ct_bigint const &rhs) {
+            return detail::equal_constant_time(lhs.limbs(), rhs.limbs()) != 0;
+        }
+
+        [[nodiscard]] friend constexpr std::strong_ordering operator<=>(ct_bigint const &lhs, ct_bigint const &rhs) {
+            auto const lhs_limbs = lhs.ordered_limbs();
+            auto const rhs_limbs = rhs.ordered_limbs();
+            auto const less = static_cast<int>(detail::less_constant_time(lhs_limbs, rhs_limbs));
+            auto const greater = static_cast<int>(detail::less_constant_time(rhs_limbs, lhs_limbs));
+            return greater - less <=> 0;
+        }
+
+        [[nodiscard]] friend constexpr ct_bigint operator+(ct_bigint const &lhs, ct_bigint const &rhs) {
+            return ct_bigint{lhs.value_ + rhs.value_};
+        }
+
+        [[nodiscard]] friend constexpr ct_bigint operator-(ct_bigint const &lhs, ct_bigint const &rhs) {
+            return ct_bigint{lhs.value_ - rhs.value_};
+        }
+
+        [[nodiscard]] friend constexpr ct_bigint operator*(ct_bigint const &lhs, ct_bigint const &rhs) {
+            auto result = limbs_type{};
+            detail::multiply_low_constant_time(lhs.limbs(), rhs.limbs(), result);
+            return make(result);
+        }
+
+        // Truncates towards zero and gives the remainder the sign of the dividend, like bigint.
+        [[nodiscard]] friend constexpr ct_bigint operator/(ct_bigint const &lhs, ct_bigint const &rhs) {
+            auto quotient = ct_bigint{};
+            auto remainder = ct_bigint{};
+            divide(lhs, rhs, quotient, remainder);
+            return quotient;
+        }
+
+        [[nodiscard]] friend constexpr ct_bigint operator%(ct_bigint const &lhs, ct_bigint const &rhs) {
+            auto quotient = ct_bigint{};
+            auto remainder = ct_bigint{};
+            divide(lhs, rhs, quotient, remainder);
+            return remainder;
+        }
+
+        [[nodiscard]] friend constexpr ct_bigint operator&(ct_bigint const &lhs, ct_bigint const &rhs) {
+            return ct_bigint{lhs.value_ & rhs.value_};
+        }
+
+        [[nodiscard]] friend constexpr ct_bigint operator|(ct_bigint const &lhs, ct_bigint const &rhs) {
+            return ct_bigint{lhs.value_ | rhs.value_};
+        }
+
+        [[nodiscard]] friend constexpr ct_bigint operator^(ct_bigint const &lhs, ct_bigint const &rhs) {
+            return ct_bigint{lhs.value_ ^ rhs.value_};
+        }
+
+        constexpr ct_bigint &operator+=(ct_bigint const &other) {
+            return *this = *this + other;
+        }
+
+        constexpr ct_bigint &operator-=(ct_bigint const &other) {
+            return *this = *this - other;
+        }
+
+        constexpr ct_bigint &operator*=(ct_bigint const &other) {
+            return *this = *this * other;
+        }
+
+        constexpr ct_bigint &operator/=(ct_bigint const &other) {
+            return *this = *this / other;
+        }
+
+        constexpr ct_bigint &operator%=(ct_bigint const &other) {
+            return *this = *this % other;
+        }
+
+        constexpr ct_bigint &operator&=(ct_bigint const &other) {
+            return *this = *this & other;
+        }
+
+        constexpr ct_bigint &operator|=(ct_bigint const &other) {
+            return *this = *this | other;
+        }
+
+        constexpr ct_bigint &operator^=(ct_bigint const &other) {
+            return *this = *this ^ other;
+        }
+
+        [[nodiscard]] constexpr ct_bigint operator~() const {
+            return ct_bigint{~value_};
+        }
+
+        [[nodiscard]] constexpr ct_bigint operator-() const {
+            auto result = limbs();
+            detail::conditional_negate(result, 1);
+            return make(result);
+        }
+
+        [[nodiscard]] constexpr ct_bigint operator<<(std::size_t const shift) const {
+            return ct_bigint{value_ << shift};
+        }
+
+        // The value is flipped to be non-negative before the shift, so the sign never selects a
+        // different path inside bigint::operator>>.
+        [[nodiscard]] constexpr ct_bigint operator>>(std::size_t const shift) const {
+            auto fill_limbs = limbs_type{};
+            fill_limbs.fill(detail::mask_from_bit(sign()));
+            auto const fill = make(fill_limbs).value_;
+            return ct_bigint{((value_ ^ fill) >> shift) ^ fill};
+        }
+
+        constexpr ct_bigint &operator<<=(std::size_t const shift) {
+            return *this = *this << shift;
+        }
+
+        constexpr ct_bigint &operator>>=(std::size_t const shift) {
+            return *this = *this >> shift;
+        }
+
+    private:
+        static constexpr std::size_t n = value_type::limb_count;
+        static constexpr std::size_t sign_position = (std::to_underlying(bits) - 1) % detail::limb_bits;
+
+        using limbs_type = std::array<detail::limb, n>;
+
+        value_type value_{};
+
+        // bigint only befriends the class, not its hidden friends, so they go through these.
+        [[nodiscard]] constexpr limbs_type limbs() const {
+            return value_.limbs();
         }
 
-        constexpr bigint operator--(int) {
-            auto result = bigint{*this};
-            --*this;
-            return result;
+        constexpr void assign_limbs(limbs_type const &limbs) {
+            value_.assign_limbs(limbs);
         }
 
-        [[nodiscard]] constexpr bigint operator&(bigint const &other) const {
-            auto result = bigint{*this};
-            result &= other;
+        [[nodiscard]] static constexpr ct_bigint make(limbs_type const &limbs) {
+            auto result = ct_bigint{};
+            result.assign_limbs(limbs);
             return result;
         }
 
-        constexpr bigint &operator&=(bigint const &other) {
-            for (auto const i: std::views::iota(0uz, data_.size())) {
-                data_[i] &= other.data_[i];
+        // 1 for negative signed values, 0 otherwise.
+        [[nodiscard]] constexpr detail::limb sign() const {
+            if constexpr (signedness == Signedness::Signed) {
+                return (limbs()[n - 1] >> sign_position) & 1;
+            } else {
+                return 0;
             }
-            return *this;
         }
 
-        [[nodiscard]] constexpr bigint operator|(bigint const &other) const {
-            auto result = bigint{*this};
-            result |= other;
+        // Limbs whose unsigned order matches the order of the values: flipping the sign bit maps
+        // the signed range onto the unsigned one.
+        [[nodiscard]] constexpr limbs_type ordered_limbs() const {
+            auto result = limbs();
+            if constexpr (signedness == Signedness::Signed) {
+                result[n - 1] ^= detail::limb{1} << sign_position;
+            }
             return result;
         }
 
-        constexpr bigint &operator|=(bigint const &other) {
-            for (auto const i: std::views::iota(0uz, data_.size())) {
-                data_[i] |= other.data_[i];
+        static constexpr void divide(ct_bigint const &dividend, ct_bigint const &divisor, ct_bigint &quotient,
+                                     ct_bigint &remainder) {
+            auto const divisor_limbs = divisor.limbs();
+            if (detail::equal_constant_time(divisor_limbs, limbs_type{}) != 0) {
+                throw std::overflow_error("Division by zero");
             }
-            return *this;
+
+            // The magnitude of the minimum signed value still fits into the width as unsigned.
+            auto const dividend_sign = dividend.sign();
+            auto const divisor_sign = divisor.sign();
+            auto dividend_magnitude = dividend.limbs();
+            auto divisor_magnitude = divisor_limbs;
+            detail::conditional_negate(dividend_magnitude, dividend_sign);
+            detail::conditional_negate(divisor_magnitude, divisor_sign);
+            dividend_magnitude[n - 1] &= value_type::top_mask;
+            divisor_magnitude[n - 1] &= value_type::top_mask;
+
+            auto quotient_limbs = limbs_type{};
+            auto remainder_limbs = limbs_type{};
+            detail::divide_constant_time(dividend_magnitude, divisor_magnitude, quotient_limbs, remainder_limbs);
+            detail::conditional_negate(quotient_limbs, dividend_sign ^ divisor_sign);
+            detail::conditional_negate(remainder_limbs, dividend_sign);
+            quotient = make(quotient_limbs);
+            remainder = make(remainder_limbs);
         }
+    };
 
-        [[nodiscard]] constexpr bigint operator^(bigint const &other) const {
-            auto result = bigint{*this};
-            result ^= other;
-            return result;
+    struct detail::limb_access {
+        template<BitWidth bits, Signedness signedness>
+        [[nodiscard]] static constexpr auto limbs(bigint<bits, signedness> const &value) {
+            return value.limbs();
         }
 
-        constexpr bigint &operator^=(bigint const &other) {
-            for (auto const i: std::views::iota(0uz, data_.size())) {
-                data_[i] ^= other.data_[i];
-            }
-            return *this;
+        template<BitWidth bits, Signedness signedness, std::size_t n>
+        static constexpr void assign(bigint<bits, signedness> &value, std::array<limb, n> const &limbs) {
+            value.assign_limbs(limbs);
         }
 
-        [[nodiscard]] constexpr bigint operator~() const {
-            auto result = bigint{*this};
-            for (auto &byte: result.data_) {
-                byte = ~byte;
-            }
-            return result;
+        template<std::size_t n, BitWidth bits, Signedness signedness>
+        [[nodiscard]] static constexpr std::array<limb, n> magnitude(bigint<bits, signedness> const &value) {
+            return value.template magnitude<n>();
         }
 
-        template<BitWidth other_bits, Signedness other_is_signed>
-        friend class bigint;
+        template<BitWidth bits, Signedness signedness>
+        [[nodiscard]] static constexpr bool is_negative(bigint<bits, signedness> const &value) {
+            return value.is_negative();
+        }
 
-#ifndef bigint_DISABLE_IO
-        template<BitWidth other_bits, Signedness other_is_signed>
-        friend constexpr std::ostream &print_hex(std::ostream &, bigint<other_bits, other_is_signed> const &, bool);
+        template<BitWidth bits, Signedness signedness>
+        static constexpr std::size_t limb_count = bigint<bits, signedness>::limb_count;
 
-        template<BitWidth other_bits, Signedness other_is_signed>
-        friend constexpr std::ostream &print_oct(std::ostream &, bigint<other_bits, other_is_signed> const &);
+        // The vector kernels read the values as one array of limbs, which matches the object
+        // representation on little-endian targets when the width is a multiple of 64 bits.
+        template<BitWidth bits, Signedness signedness>
+        static constexpr bool contiguous = std::endian::native == std::endian::little and
+                                           bigint<bits, signedness>::tail_bits == 0 and
+                                           sizeof(bigint<bits, signedness>) == limb_count<bits, signedness> * sizeof(limb);
 
-        template<BitWidth other_bits, Signedness other_is_signed>
-        friend constexpr std::ostream &print_dec(std::ostream &, bigint<other_bits, other_is_signed> const &);
+        template<BitWidth bits, Signedness signedness>
+        [[nodiscard]] static limb const *data(std::span<bigint<bits, signedness> const> const values) {
+            return reinterpret_cast<limb const *>(values.data());
+        }
 
-        template<BitWidth other_bits, Signedness other_is_signed>
-        friend constexpr std::ostream &operator<<(std::ostream &, bigint<other_bits, other_is_signed> const &);
+        template<BitWidth bits, Signedness signedness>
+        [[nodiscard]] static limb *data(std::span<bigint<bits, signedness>> const values) {
+            return reinterpret_cast<limb *>(values.data());
+        }
+    };
 
-        template<BitWidth other_bits, Signedness other_is_signed>
-        friend constexpr std::istream &operator>>(std::istream &, bigint<other_bits, other_is_signed> &);
-#endif
+    // Fused multiply-add: lhs * rhs + addend with the wrapping of operator* and operator+, but the
+    // product is added as it is formed instead of going through a temporary bigint.
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] constexpr bigint<bits, signedness> fma(bigint<bits, signedness> const &lhs,
+                                                         bigint<bits, signedness> const &rhs,
+                                                         bigint<bits, signedness> const &addend) {
+        using access = detail::limb_access;
+        auto accumulator = access::limbs(addend);
+        detail::accumulate_product(access::limbs(lhs), access::limbs(rhs), accumulator, false);
+        auto result = bigint<bits, signedness>{};
+        access::assign(result, accumulator);
+        return result;
+    }
 
-        template<BitWidth other_bits, Signedness other_is_signed>
-        friend constexpr bigint<other_bits, other_is_signed> byteswap(bigint<other_bits, other_is_signed> const &);
+    // accumulator += lhs * rhs and accumulator -= lhs * rhs in place.
+    template<BitWidth bits, Signedness signedness>
+    constexpr bigint<bits, signedness> &mul_add(bigint<bits, signedness> &accumulator, bigint<bits, signedness> const &lhs,
+                                                bigint<bits, signedness> const &rhs) {
+        using access = detail::limb_access;
+        auto limbs = access::limbs(accumulator);
+        detail::accumulate_product(access::limbs(lhs), access::limbs(rhs), limbs, false);
+        access::assign(accumulator, limbs);
+        return accumulator;
+    }
 
-    private:
-        [[nodiscard]] constexpr bool get_bit(std::size_t const pos) const {
-            auto const byte_index = std::size_t{pos / CHAR_BIT};
-            auto const bit_index = std::size_t{pos % CHAR_BIT};
-            if constexpr (std::endian::native == std::endian::little) {
-                return (data_[byte_index] >> bit_index) & 1;
-            } else {
-                auto const index = std::size_t{data_.size() - 1 - byte_index};
-                return (data_[index] >> bit_index) & 1;
-            }
-        }
+    template<BitWidth bits, Signedness signedness>
+    constexpr bigint<bits, signedness> &mul_sub(bigint<bits, signedness> &accumulator, bigint<bits, signedness> const &lhs,
+                                                bigint<bits, signedness> const &rhs) {
+        using access = detail::limb_access;
+        auto limbs = access::limbs(accumulator);
+        detail::accumulate_product(access::limbs(lhs), access::limbs(rhs), limbs, true);
+        access::assign(accumulator, limbs);
+        return accumulator;
+    }
 
-        constexpr void set_bit(std::size_t const pos, bool const value) {
-            auto const byte_index = std::size_t{pos / CHAR_BIT};
-            auto const bit_index = std::size_t{pos % CHAR_BIT};
-            if constexpr (std::endian::native == std::endian::little) {
-                if (value) {
-                    data_[byte_index] |= static_cast<std::uint8_t>(1U << bit_index);
-                } else {
-                    data_[byte_index] &= static_cast<std::uint8_t>(~(1U << bit_index));
-                }
-            } else {
-                auto const index = std::size_t{data_.size() - 1 - byte_index};
-                if (value) {
-                    data_[index] |= static_cast<std::uint8_t>(1U << bit_index);
-                } else {
-                    data_[index] &= static_cast<std::uint8_t>(~(1U << bit_index));
-                }
-            }
+    // Batch operations over spans of values. out[i] = lhs[i] op rhs[i] with the same wrapping
+    // semantics as the operators, so no element throws. On x86-64 add_n, compare_n and sum_reduce
+    // use AVX-512 or AVX2 when the CPU supports it and the width is 64, 128 or 256 bits or a
+    // multiple of 256 bits (from 256 bits on for compare_n); all other cases and constant
+    // evaluation use scalar limb loops.
+    template<BitWidth bits, Signedness signedness>
+    constexpr void add_n(std::span<bigint<bits, signedness>> const out,
+                         std::type_identity_t<std::span<bigint<bits, signedness> const>> const lhs,
+                         std::type_identity_t<std::span<bigint<bits, signedness> const>> const rhs) {
+        using access = detail::limb_access;
+        constexpr auto n = access::limb_count<bits, signedness>;
+        if (lhs.size() != out.size() or rhs.size() != out.size()) {
+            throw std::invalid_argument("Batch operands must have the same size.");
         }
-
-        constexpr void multiply_by(std::uint32_t const multiplier) {
-            auto carry = std::uint32_t{0};
-            if constexpr (std::endian::native == std::endian::little) {
-                for (auto const i: std::views::iota(0uz, data_.size())) {
-                    auto const prod = std::uint32_t{static_cast<std::uint32_t>(data_[i]) * multiplier + carry};
-                    data_[i] = static_cast<std::uint8_t>(prod & 0xFF);
-                    carry = prod >> 8;
+        auto done = 0uz;
+#if defined(bigint_HAS_BATCH_SIMD)
+        if !consteval {
+            if constexpr (access::contiguous<bits, signedness>) {
+                auto const isa = detail::detect_batch_isa();
+                if constexpr (detail::batch_fits<n, 8>) {
+                    if (isa == detail::batch_isa::avx512) {
+                        done = detail::add_avx512<n>(access::data(out), access::data(lhs), access::data(rhs), out.size());
+                    }
                 }
-            } else {
-                for (auto const i: std::views::reverse(std::views::iota(1uz, data_.size() + 1))) {
-                    auto const idx = std::size_t{i - 1};
-                    auto const prod = std::uint32_t{static_cast<std::uint32_t>(data_[idx]) * multiplier + carry};
-                    data_[idx] = static_cast<std::uint8_t>(prod & 0xFF);
-                    carry = prod >> 8;
+                if constexpr (detail::batch_fits<n, 4>) {
+                    if (isa == detail::batch_isa::avx2) {
+                        done = detail::add_avx2<n>(access::data(out), access::data(lhs), access::data(rhs), out.size());
+                    }
                 }
             }
-            if (carry != 0) {
-                throw std::overflow_error("Overflow during multiplication");
+        }
+#endif
+        for (auto const i: std::views::iota(done, out.size())) {
+            auto const a = access::limbs(lhs[i]);
+            auto const b = access::limbs(rhs[i]);
+            auto result = std::array<detail::limb, n>{};
+            auto carry = detail::limb{0};
+            for (auto const k: std::views::iota(0uz, n)) {
+                result[k] = detail::add_with_carry(a[k], b[k], carry);
             }
+            access::assign(out[i], result);
         }
+    }
 
-        constexpr void add_value(std::uint8_t const value) {
-            auto carry = std::uint16_t{value};
-            if constexpr (std::endian::native == std::endian::little) {
-                for (auto i = 0uz; i < data_.size() and carry; ++i) {
-                    auto const sum = static_cast<std::uint16_t>(static_cast<std::uint16_t>(data_[i]) + carry);
-                    data_[i] = static_cast<std::uint8_t>(sum & 0xFF);
-                    carry = sum >> 8;
+    // Truncated products. 64-bit lanes have no full-width vector multiply, so this stays scalar but
+    // skips the temporaries of operator*.
+    template<BitWidth bits, Signedness signedness>
+    constexpr void mul_n(std::span<bigint<bits, signedness>> const out,
+                         std::type_identity_t<std::span<bigint<bits, signedness> const>> const lhs,
+                         std::type_identity_t<std::span<bigint<bits, signedness> const>> const rhs) {
+        using access = detail::limb_access;
+        if (lhs.size() != out.size() or rhs.size() != out.size()) {
+            throw std::invalid_argument("Batch operands must have the same size.");
+        }
+        for (auto const i: std::views::iota(0uz, out.size())) {
+            auto result = std::array<detail::limb, access::limb_count<bits, signedness>>{};
+            detail::multiply(access::limbs(lhs[i]), access::limbs(rhs[i]), result);
+            access::assign(out[i], result);
+        }
+    }
+
+    template<BitWidth bits, Signedness signedness>
+    constexpr void compare_n(std::span<std::strong_ordering> const out,
+                             std::span<bigint<bits, signedness> const> const lhs,
+                             std::type_identity_t<std::span<bigint<bits, signedness> const>> const rhs) {
+        if (lhs.size() != out.size() or rhs.size() != out.size()) {
+            throw std::invalid_argument("Batch operands must have the same size.");
+        }
+        auto done = 0uz;
+#if defined(bigint_HAS_BATCH_SIMD)
+        using access = detail::limb_access;
+        // Values of one or two limbs compare in a few scalar instructions; the vector kernels only
+        // pay off from 256 bits on.
+        if !consteval {
+            if constexpr (access::contiguous<bits, signedness> and access::limb_count<bits, signedness> >= 4) {
+                constexpr auto n = access::limb_count<bits, signedness>;
+                constexpr auto is_signed = signedness == Signedness::Signed;
+                auto const isa = detail::detect_batch_isa();
+                if constexpr (detail::batch_fits<n, 8>) {
+                    if (isa == detail::batch_isa::avx512) {
+                        done = detail::compare_avx512<n, is_signed>(out.data(), access::data(lhs), access::data(rhs),
+                                                                    out.size());
+                    }
                 }
-            } else {
-                for (auto i = data_.size(); i > 0uz and carry; --i) {
-                    auto const idx = std::size_t{i - 1};
-                    auto const sum = static_cast<std::uint16_t>(static_cast<std::uint16_t>(data_[idx]) + carry);
-                    data_[idx] = static_cast<std::uint8_t>(sum & 0xFF);
-                    carry = sum >> 8;
+                if constexpr (detail::batch_fits<n, 4>) {
+                    if (isa == detail::batch_isa::avx2) {
+                        done = detail::compare_avx2<n, is_signed>(out.data(), access::data(lhs), access::data(rhs),
+                                                                  out.size());
+                    }
                 }
             }
-            if (carry != 0) {
-                throw std::overflow_error("Overflow during addition");
-            }
         }
+#endif
+        for (auto const i: std::views::iota(done, out.size())) {
+            out[i] = lhs[i] <=> rhs[i];
+        }
+    }
 
-        constexpr void init_from_string_base(std::string_view const str, std::uint32_t const base) {
-            data_.fill(0);
-            for (auto const c: str) {
-                if (c == '\'' or c == ' ') {
-                    continue;
-                }
-                std::uint8_t digit = 0;
-                if (c >= '0' and c <= '9') {
-                    digit = static_cast<std::uint8_t>(c - '0');
-                } else if (c >= 'a' and c <= 'f') {
-                    digit = static_cast<std::uint8_t>(10 + (c - 'a'));
-                } else if (c >= 'A' and c <= 'F') {
-                    digit = static_cast<std::uint8_t>(10 + (c - 'A'));
-                } else {
-                    throw std::runtime_error("Invalid digit in input string.");
+    // Wrapping sum of all values. Limbs are accumulated independently with a carry count each, so
+    // the loop has no carry chain from one value to the next.
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] constexpr bigint<bits, signedness> sum_reduce(std::span<bigint<bits, signedness> const> const values) {
+        using access = detail::limb_access;
+        constexpr auto n = access::limb_count<bits, signedness>;
+        auto result = std::array<detail::limb, n>{};
+        auto done = 0uz;
+#if defined(bigint_HAS_BATCH_SIMD)
+        if !consteval {
+            if constexpr (access::contiguous<bits, signedness>) {
+                auto const isa = detail::detect_batch_isa();
+                if constexpr (detail::batch_fits<n, 8>) {
+                    if (isa == detail::batch_isa::avx512) {
+                        done = detail::sum_avx512<n>(result, access::data(values), values.size());
+                    }
                 }
-                if (digit >= base) {
-                    throw std::runtime_error("Digit out of range for base.");
+                if constexpr (detail::batch_fits<n, 4>) {
+                    if (isa == detail::batch_isa::avx2) {
+                        done = detail::sum_avx2<n>(result, access::data(values), values.size());
+                    }
                 }
-                multiply_by(base);
-                add_value(digit);
             }
         }
+#endif
+        auto acc = std::array<detail::limb, n>{};
+        auto carries = std::array<detail::limb, n>{};
+        for (auto const i: std::views::iota(done, values.size())) {
+            auto const value = access::limbs(values[i]);
+            for (auto const k: std::views::iota(0uz, n)) {
+                acc[k] += value[k];
+                carries[k] += acc[k] < value[k];
+            }
+        }
+        detail::fold_carry_save(result, acc.data(), carries.data(), n);
+        auto sum = bigint<bits, signedness>{};
+        access::assign(sum, result);
+        return sum;
+    }
 
-        template<std::size_t max_size, Signedness other_signedness>
-        constexpr bool spaceship_check_index(std::array<std::uint8_t, max_size> lhs_extended,
-                                             std::array<std::uint8_t, max_size> rhs_extended,
-                                             std::size_t const i, std::strong_ordering &value) const {
-            if constexpr (signedness == Signedness::Unsigned and other_signedness == Signedness::Unsigned) {
-                auto const a = lhs_extended[i];
-                auto const b = rhs_extended[i];
-                if (a < b) {
-                    value = std::strong_ordering::less;
-                    return true;
-                }
-                if (a > b) {
-                    value = std::strong_ordering::greater;
-                    return true;
-                }
-            } else if constexpr (signedness == Signedness::Unsigned and signedness == Signedness::Signed) {
-                auto const a = lhs_extended[i];
-                auto const b = static_cast<std::int8_t>(rhs_extended[i]);
-                if (a < b) {
-                    value = std::strong_ordering::less;
-                    return true;
-                }
-                if (a > b) {
-                    value = std::strong_ordering::greater;
-                    return true;
-                }
-            } else if constexpr (signedness == Signedness::Signed and other_signedness == Signedness::Unsigned) {
-                auto const a = static_cast<std::int8_t>(lhs_extended[i]);
-                auto const b = rhs_extended[i];
-                if (a < b) {
-                    value = std::strong_ordering::less;
-                    return true;
-                }
-                if (a > b) {
-                    value = std::strong_ordering::greater;
-                    return true;
-                }
+#if defined(bigint_HAS_PARALLEL)
+    template<typename Policy>
+    concept execution_policy = std::is_execution_policy_v<std::remove_cvref_t<Policy>>;
+
+    namespace detail {
+        // Calls function with the fork matching the policy: parallel_fork with one thread per
+        // hardware thread for par and par_unseq, sequential_fork for seq and unseq.
+        template<typename Policy, typename Function>
+        decltype(auto) with_fork(Function const &function) {
+            using policy = std::remove_cvref_t<Policy>;
+            if constexpr (std::is_same_v<policy, std::execution::parallel_policy> or
+                          std::is_same_v<policy, std::execution::parallel_unsequenced_policy>) {
+                static auto const threads = std::size_t{std::max(std::thread::hardware_concurrency(), 1u)};
+                return function(parallel_fork{parallel_threshold, threads});
             } else {
-                auto const a = static_cast<std::int8_t>(lhs_extended[i]);
-                auto const b = static_cast<std::int8_t>(rhs_extended[i]);
-                if (a < b) {
-                    value = std::strong_ordering::less;
-                    return true;
-                }
-                if (a > b) {
-                    value = std::strong_ordering::greater;
-                    return true;
-                }
+                return function(sequential_fork{});
             }
-            return false;
         }
-    };
+    }
+
+    // operator* and wide_multiply with an execution policy. With std::execution::par the
+    // Karatsuba and Toom-3 subproducts of operands from bigint_PARALLEL_THRESHOLD limbs on run on
+    // separate threads; narrower operands and the other policies take the sequential path.
+    template<execution_policy Policy, BitWidth bits, Signedness signedness>
+    [[nodiscard]] bigint<bits, signedness> multiply(Policy &&, bigint<bits, signedness> const &lhs,
+                                                    bigint<bits, signedness> const &rhs) {
+        using access = detail::limb_access;
+        auto product = std::array<detail::limb, access::limb_count<bits, signedness>>{};
+        detail::with_fork<Policy>([&](auto const &fork) {
+            detail::multiply(access::limbs(lhs), access::limbs(rhs), product, fork);
+        });
+        auto result = bigint<bits, signedness>{};
+        access::assign(result, product);
+        return result;
+    }
+
+    template<execution_policy Policy, BitWidth bits, Signedness signedness>
+    [[nodiscard]] bigint<double_width<bits>, signedness> wide_multiply(Policy &&, bigint<bits, signedness> const &lhs,
+                                                                       bigint<bits, signedness> const &rhs) {
+        using access = detail::limb_access;
+        constexpr auto n = access::limb_count<bits, signedness>;
+        auto product = std::array<detail::limb, 2 * n>{};
+        detail::with_fork<Policy>([&](auto const &fork) {
+            detail::multiply_full(access::magnitude<n>(lhs), access::magnitude<n>(rhs), product, fork);
+        });
+        if (access::is_negative(lhs) != access::is_negative(rhs)) {
+            detail::negate(product);
+        }
+        auto result = bigint<double_width<bits>, signedness>{};
+        access::assign(result, product);
+        return result;
+    }
+#endif
 
 #ifndef bigint_DISABLE_IO
     template<BitWidth bits, Signedness signedness>
     constexpr std::ostream &print_hex(std::ostream &os, bigint<bits, signedness> const &data, bool const use_uppercase) {
-        auto const &buf = data.data_;
-
-        if constexpr (std::endian::native == std::endian::little) {
-            auto start = buf.size();
-            while (start > 1 and buf[start - 1] == 0) {
-                --start;
-            }
-            for (auto const i: std::views::reverse(std::views::iota(0uz, start))) {
-                auto local = std::array<char, 3>{};
-                std::snprintf(
-                    local.data(),
-                    local.size(),
-                    use_uppercase ? "%02X" : "%02x",
-                    buf[i]
-                );
-                os.write(local.data(), local.size() - 1);
-            }
-        } else {
-            auto start = 0uz;
-            while (start < buf.size() - 1 and buf[start] == 0) {
-                ++start;
-            }
-            for (auto const i: std::views::iota(start, buf.size())) {
-                auto local = std::array<char, 3>{};
-                std::snprintf(
-                    local.data(),
-                    local.size(),
-                    use_uppercase ? "%02X" : "%02x",
-                    buf[i]
-                );
-                os.write(local.data(), local.size() - 1);
-            }
+        constexpr auto size = std::size_t{std::to_underlying(bits) / CHAR_BIT};
+        auto const digits = std::string_view{use_uppercase ? "0123456789ABCDEF" : "0123456789abcdef"};
+        auto const byte = [&data](std::size_t const i) {
+            return static_cast<std::uint8_t>(data.limb(i / sizeof(detail::limb)) >> (i % sizeof(detail::limb) * CHAR_BIT));
+        };
+
+        auto start = size;
+        while (start > 1 and byte(start - 1) == 0) {
+            --start;
+        }
+
+        auto buffer = std::array<char, size * 2>{};
+        auto pos = buffer.begin();
+        for (auto const i: std::views::reverse(std::views::iota(0uz, start))) {
+            *pos++ = digits[byte(i) >> 4];
+            *pos++ = digits[byte(i) & 0xF];
         }
 
+        auto const length = static_cast<std::streamsize>(pos - buffer.begin());
+        os.write(buffer.data(), length);
         return os;
     }
 
     template<BitWidth bits, Signedness signedness>
     constexpr std::ostream &print_oct(std::ostream &os, bigint<bits, signedness> const &data) {
-        auto temp = data;
-
-        if (temp == std::int8_t{0}) {
+        if (data == std::int8_t{0}) {
             os.put('0');
             return os;
         }
 
         constexpr auto max_oct_digits = std::size_t{(std::to_underlying(bits) / 3) + 2};
         auto buffer = std::array<char, max_oct_digits>{};
-        auto pos = buffer.end();
+        auto const last = buffer.data() + buffer.size();
+        auto const first = detail::format_power_of_two(data.limbs(), last, 3);
 
-        while (temp != std::int8_t{0}) {
-            auto r = temp % std::int8_t{8};
-            auto digit = std::uint8_t{0};
-            if constexpr (std::endian::native == std::endian::little) {
-                digit = r.data_[0];
-            } else {
-                digit = r.data_[r.data_.size() - 1];
-            }
-            *--pos = static_cast<char>('0' + digit);
-            temp /= std::int8_t{8};
-        }
-
-        auto const length = static_cast<std::streamsize>(buffer.end() - pos);
-        os.write(std::to_address(pos), length);
+        os.write(first, static_cast<std::streamsize>(last - first));
         return os;
     }
 
     template<BitWidth bits, Signedness signedness>
     constexpr std::ostream &print_dec(std::ostream &os, bigint<bits, signedness> const &data) {
-        auto temp = data;
-
-        if (temp == std::int8_t{0}) {
+        if (data == std::int8_t{0}) {
             os.put('0');
             return os;
         }
 
-        auto negative = false;
-        if constexpr (signedness == Signedness::Signed) {
-            if (temp < std::int8_t{0}) {
-                negative = true;
-                temp = -temp;
-            }
-        }
-
         constexpr auto max_dec_digits = std::size_t{static_cast<std::size_t>(std::to_underlying(bits) * 0.3010299957) + 3}; //std::log10(2)
         auto buffer = std::array<char, max_dec_digits>{};
-        auto pos = buffer.end();
+        auto const last = buffer.data() + buffer.size();
+        auto const first = detail::format_decimal(data.template magnitude<bigint<bits, signedness>::limb_count>(), last);
 
-        while (temp != std::int8_t{0}) {
-            auto r = temp % std::int8_t{10};
-            auto digit = std::uint8_t{0};
-            if constexpr (std::endian::native == std::endian::little) {
-                digit = r.data_[0];
-            } else {
-                digit = r.data_[r.data_.size() - 1];
-            }
-            *--pos = static_cast<char>('0' + digit);
-            temp /= std::int8_t{10};
+        if (data.is_negative()) {
+            os.put('-');
         }
 
-        if (negative) {
+        os.write(first, static_cast<std::streamsize>(last - first));
+        return os;
+    }
+
+#if defined(bigint_HAS_PARALLEL)
+    // print_dec with an execution policy. With std::execution::par the two halves of each divide
+    // and conquer step are converted on separate threads; the divisions themselves stay sequential.
+    template<execution_policy Policy, BitWidth bits, Signedness signedness>
+    std::ostream &print_dec(Policy &&, std::ostream &os, bigint<bits, signedness> const &data) {
+        using access = detail::limb_access;
+        if (data == std::int8_t{0}) {
+            os.put('0');
+            return os;
+        }
+
+        constexpr auto max_dec_digits = std::size_t{static_cast<std::size_t>(std::to_underlying(bits) * 0.3010299957) + 3}; //std::log10(2)
+        auto buffer = std::array<char, max_dec_digits>{};
+        auto const last = buffer.data() + buffer.size();
+        auto const first = detail::with_fork<Policy>([&](auto const &fork) {
+            return detail::format_decimal(access::magnitude<access::limb_count<bits, signedness>>(data), last, fork);
+        });
+
+        if (access::is_negative(data)) {
             os.put('-');
         }
 
-        auto const length = static_cast<std::streamsize>(buffer.end() - pos);
-        os.write(std::to_address(pos), length);
+        os.write(first, static_cast<std::streamsize>(last - first));
         return os;
     }
+#endif
 
     template<BitWidth bits, Signedness signedness>
     constexpr std::ostream &operator<<(std::ostream &os, bigint<bits, signedness> const &data) {
@@ -1183,8 +4199,19 @@ namespace bigint {
 
     template<BitWidth bits, Signedness signedness>
     constexpr bigint<bits, signedness> byteswap(bigint<bits, signedness> const &data) {
-        auto result = bigint<bits, signedness>{data};
-        std::ranges::reverse(result.data_);
+        using type = bigint<bits, signedness>;
+        auto result = type{};
+        for (auto const i: std::views::iota(0uz, type::limb_count)) {
+            result.limb(i) = std::byteswap(data.limb(type::limb_count - 1 - i));
+        }
+        if constexpr (type::tail_bits != 0) {
+            // The unused high bytes of the top limb ended up at the bottom; move the value down.
+            constexpr auto padding = std::size_t{detail::limb_bits - type::tail_bits};
+            for (auto const i: std::views::iota(0uz, type::limb_count)) {
+                auto const upper = i + 1 < type::limb_count ? result.limb(i + 1) : 0;
+                result.limb(i) = (result.limb(i) >> padding) | (upper << (detail::limb_bits - padding));
+            }
+        }
         return result;
     }
 
@@ -1200,4 +4227,299 @@ namespace bigint {
             return result;
         }
     }
+
+    // The <bit> functions on the bits of the two's complement representation, one limb at a time.
+    // Unlike the standard ones they accept signed types as well.
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] constexpr int popcount(bigint<bits, signedness> const &value) {
+        auto count = 0;
+        for (auto const limb: detail::limb_access::limbs(value)) {
+            count += std::popcount(limb);
+        }
+        return count;
+    }
+
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] constexpr bool has_single_bit(bigint<bits, signedness> const &value) {
+        auto found = false;
+        for (auto const limb: detail::limb_access::limbs(value)) {
+            if (limb != 0) {
+                if (found or not std::has_single_bit(limb)) {
+                    return false;
+                }
+                found = true;
+            }
+        }
+        return found;
+    }
+
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] constexpr int countl_zero(bigint<bits, signedness> const &value) {
+        auto const limbs = detail::limb_access::limbs(value);
+        // The unused bits of the top limb are always zero.
+        constexpr auto padding = static_cast<int>(limbs.size() * detail::limb_bits - std::to_underlying(bits));
+        auto count = -padding;
+        for (auto const limb: std::views::reverse(limbs)) {
+            if (limb != 0) {
+                return count + std::countl_zero(limb);
+            }
+            count += std::numeric_limits<detail::limb>::digits;
+        }
+        return count;
+    }
+
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] constexpr int countr_zero(bigint<bits, signedness> const &value) {
+        auto count = 0;
+        for (auto const limb: detail::limb_access::limbs(value)) {
+            if (limb != 0) {
+                return count + std::countr_zero(limb);
+            }
+            count += std::numeric_limits<detail::limb>::digits;
+        }
+        return static_cast<int>(std::to_underlying(bits));
+    }
+
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] constexpr int countl_one(bigint<bits, signedness> const &value) {
+        return countl_zero(~value);
+    }
+
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] constexpr int countr_one(bigint<bits, signedness> const &value) {
+        return countr_zero(~value);
+    }
+
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] constexpr int bit_width(bigint<bits, signedness> const &value) {
+        return static_cast<int>(std::to_underlying(bits)) - countl_zero(value);
+    }
+
+    // Rotates the bits left by shift modulo the width; a negative shift rotates right.
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] constexpr bigint<bits, signedness> rotl(bigint<bits, signedness> const &value, int const shift) {
+        constexpr auto width = static_cast<long long>(std::to_underlying(bits));
+        auto const amount = static_cast<std::size_t>((shift % width + width) % width);
+        if (amount == 0) {
+            return value;
+        }
+        auto const limbs = detail::limb_access::limbs(value);
+        constexpr auto n = limbs.size();
+
+        auto low = limbs;
+        auto high = limbs;
+        detail::shift_left(low, amount);
+        detail::shift_right(high, static_cast<std::size_t>(width) - amount);
+        for (auto const i: std::views::iota(0uz, n)) {
+            low[i] |= high[i];
+        }
+        auto result = bigint<bits, signedness>{};
+        detail::limb_access::assign(result, low);
+        return result;
+    }
+
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] constexpr bigint<bits, signedness> rotr(bigint<bits, signedness> const &value, int const shift) {
+        return rotl(value, -(shift % static_cast<int>(std::to_underlying(bits))));
+    }
+
+    // A bigint is nothing but its limbs, so arrays of them can be copied with memcpy, placed in
+    // shared memory and relocated by containers without running any code. The layout does not
+    // depend on the width beyond the number of limbs, so a few widths stand for all of them. The
+    // checks come last because instantiating bigint declares its friends.
+    static_assert(std::is_trivially_copyable_v<bigint<BitWidth{64}, Signedness::Signed>> and
+                  std::is_trivially_copyable_v<bigint<BitWidth{72}, Signedness::Unsigned>> and
+                  std::is_trivially_copyable_v<bigint<BitWidth{512}, Signedness::Signed>>);
+    static_assert(std::is_standard_layout_v<bigint<BitWidth{64}, Signedness::Signed>> and
+                  std::is_standard_layout_v<bigint<BitWidth{72}, Signedness::Unsigned>> and
+                  std::is_standard_layout_v<bigint<BitWidth{512}, Signedness::Signed>>);
+}
+
+#if defined(__cpp_lib_format)
+namespace std {
+    // Supports the integer format specification [[fill]align][sign][#][0][width][L][type] with the
+    // types b, B, d, o, x and X. Digits come from to_chars and are written straight to the output.
+    template<bigint::BitWidth bits, bigint::Signedness signedness>
+    struct formatter<bigint::bigint<bits, signedness>, char> {
+    private:
+        enum class alignment : std::uint8_t {
+            none,
+            left,
+            right,
+            center
+        };
+
+        std::array<char, 4> fill_{' '};
+        std::size_t fill_size_{1};
+        alignment align_{alignment::none};
+        char sign_{'-'};
+        bool alternate_{false};
+        bool zero_pad_{false};
+        bool localized_{false};
+        std::size_t width_{0};
+        char type_{'d'};
+
+        [[nodiscard]] static constexpr alignment alignment_of(char const c) {
+            switch (c) {
+                case '<':
+                    return alignment::left;
+                case '>':
+                    return alignment::right;
+                case '^':
+                    return alignment::center;
+                default:
+                    return alignment::none;
+            }
+        }
+
+        [[nodiscard]] static constexpr std::size_t code_point_size(char const c) {
+            auto const lead = static_cast<unsigned char>(c);
+            if ((lead & 0x80) == 0) {
+                return 1;
+            }
+            if ((lead & 0xE0) == 0xC0) {
+                return 2;
+            }
+            return (lead & 0xF0) == 0xE0 ? 3 : 4;
+        }
+
+        template<typename OutputIt>
+        OutputIt write_fill(OutputIt out, std::size_t count) const {
+            for (; count > 0; --count) {
+                out = std::copy_n(fill_.data(), fill_size_, out);
+            }
+            return out;
+        }
+
+    public:
+        constexpr auto parse(std::format_parse_context &ctx) {
+            auto it = ctx.begin();
+            auto const end = ctx.end();
+
+            if (it != end and *it != '}') {
+                auto const size = code_point_size(*it);
+                if (static_cast<std::size_t>(end - it) > size and alignment_of(it[size]) != alignment::none) {
+                    std::copy_n(it, size, fill_.begin());
+                    fill_size_ = size;
+                    align_ = alignment_of(it[size]);
+                    it += size + 1;
+                } else if (alignment_of(*it) != alignment::none) {
+                    align_ = alignment_of(*it++);
+                }
+            }
+            if (it != end and (*it == '+' or *it == '-' or *it == ' ')) {
+                sign_ = *it++;
+            }
+            if (it != end and *it == '#') {
+                alternate_ = true;
+                ++it;
+            }
+            if (it != end and *it == '0') {
+                zero_pad_ = true;
+                ++it;
+            }
+            for (; it != end and *it >= '0' and *it <= '9'; ++it) {
+                width_ = width_ * 10 + static_cast<std::size_t>(*it - '0');
+            }
+            if (it != end and *it == 'L') {
+                localized_ = true;
+                ++it;
+            }
+            if (it != end and std::string_view{"bBdoxX"}.contains(*it)) {
+                type_ = *it++;
+            }
+            if (it != end and *it != '}') {
+                throw std::format_error("Invalid format specification for bigint.");
+            }
+            return it;
+        }
+
+        template<typename FormatContext>
+        auto format(bigint::bigint<bits, signedness> const &value, FormatContext &ctx) const {
+            auto base = 10;
+            auto prefix = std::string_view{};
+            switch (type_) {
+                case 'b':
+                case 'B':
+                    base = 2;
+                    prefix = type_ == 'b' ? "0b" : "0B";
+                    break;
+                case 'o':
+                    base = 8;
+                    prefix = "0";
+                    break;
+                case 'x':
+                case 'X':
+                    base = 16;
+                    prefix = type_ == 'x' ? "0x" : "0X";
+                    break;
+                default:
+                    break;
+            }
+
+            // Binary output of the minimum value needs one digit per bit plus the sign.
+            auto buffer = std::array<char, std::to_underlying(bits) + 1>{};
+            auto const result = bigint::to_chars(buffer.data(), buffer.data() + buffer.size(), value, base);
+            auto digits = std::string_view{buffer.data(), result.ptr};
+            if (type_ == 'X') {
+                for (auto &c: std::ranges::subrange(buffer.data(), result.ptr)) {
+                    if (c >= 'a' and c <= 'z') {
+                        c = static_cast<char>(c - 'a' + 'A');
+                    }
+                }
+            }
+
+            auto sign = std::string_view{};
+            if (digits.front() == '-') {
+                sign = "-";
+                digits.remove_prefix(1);
+            } else if (sign_ == '+') {
+                sign = "+";
+            } else if (sign_ == ' ') {
+                sign = " ";
+            }
+            if (not alternate_ or (base == 8 and digits == "0")) {
+                prefix = {};
+            }
+
+            // Digit grouping follows the numpunct facet of the context's locale.
+            auto grouped = std::string{};
+            if (localized_) {
+                auto const &punct = std::use_facet<std::numpunct<char>>(ctx.locale());
+                auto const grouping = punct.grouping();
+                auto group = 0uz;
+                auto count = 0;
+                for (auto const c: std::views::reverse(digits)) {
+                    auto const size = grouping.empty() ? 0 : grouping[std::min(group, grouping.size() - 1)];
+                    if (size > 0 and size != CHAR_MAX and count == size) {
+                        grouped.push_back(punct.thousands_sep());
+                        ++group;
+                        count = 0;
+                    }
+                    grouped.push_back(c);
+                    ++count;
+                }
+                std::ranges::reverse(grouped);
+                digits = grouped;
+            }
+
+            auto const size = sign.size() + prefix.size() + digits.size();
+            auto const padding = width_ > size ? width_ - size : 0;
+            auto out = ctx.out();
+            if (align_ == alignment::none and zero_pad_) {
+                out = std::ranges::copy(sign, out).out;
+                out = std::ranges::copy(prefix, out).out;
+                out = std::fill_n(out, padding, '0');
+                return std::ranges::copy(digits, out).out;
+            }
+
+            auto const before = align_ == alignment::left ? 0 : align_ == alignment::center ? padding / 2 : padding;
+            out = write_fill(out, before);
+            out = std::ranges::copy(sign, out).out;
+            out = std::ranges::copy(prefix, out).out;
+            out = std::ranges::copy(digits, out).out;
+            return write_fill(out, padding - before);
+        }
+    };
 }
+#endif
@@ -0,0 +1,115 @@
+#pragma once
+
+// Runtime CPU dispatch for the limb kernels. This part is compiled into the optional
+// bigint::dispatch library (configure with -DBUILD_DISPATCH=ON); bigint.hpp stays header-only and
+// constexpr and does not depend on it. The kernels are picked once, on first use, from cpuid.
+
+#include <bigint23/bigint.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+
+namespace bigint::dispatch {
+    enum class variant : std::uint8_t {
+        generic,
+        bmi2_adx,
+        avx2,
+        avx512
+    };
+
+    // The variants in use: arithmetic is generic or bmi2_adx, batch is generic, avx2 or avx512 and
+    // names the kernels that add_n, compare_n and sum_reduce from bigint.hpp use on this CPU.
+    struct selection {
+        variant arithmetic;
+        variant batch;
+    };
+
+    [[nodiscard]] selection selected() noexcept;
+    [[nodiscard]] std::string_view to_string(variant value) noexcept;
+
+    // Raw kernels on little-endian limb arrays of the given sizes. The output must not overlap
+    // the inputs of mul_limbs and mul_low_limbs.
+
+    // out = lhs + rhs, returns the carry out of the top limb.
+    detail::limb add_limbs(detail::limb *out, detail::limb const *lhs, detail::limb const *rhs, std::size_t size) noexcept;
+    // out = lhs - rhs, returns the borrow out of the top limb.
+    detail::limb sub_limbs(detail::limb *out, detail::limb const *lhs, detail::limb const *rhs, std::size_t size) noexcept;
+    // out[0, lhs_size + rhs_size) = lhs * rhs.
+    void mul_limbs(detail::limb *out, detail::limb const *lhs, std::size_t lhs_size,
+                   detail::limb const *rhs, std::size_t rhs_size) noexcept;
+    // out[0, size) = the low size limbs of lhs * rhs.
+    void mul_low_limbs(detail::limb *out, detail::limb const *lhs, detail::limb const *rhs, std::size_t size) noexcept;
+
+    // The runtime dispatched counterparts of operator+, operator-, operator* and wide_multiply.
+    // They give the same results, but are not constexpr.
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] bigint<bits, signedness> add(bigint<bits, signedness> const &lhs, bigint<bits, signedness> const &rhs) {
+        using access = detail::limb_access;
+        auto const a = access::limbs(lhs);
+        auto const b = access::limbs(rhs);
+        auto sum = decltype(a){};
+        std::ignore = add_limbs(sum.data(), a.data(), b.data(), sum.size());
+        auto result = bigint<bits, signedness>{};
+        access::assign(result, sum);
+        return result;
+    }
+
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] bigint<bits, signedness> subtract(bigint<bits, signedness> const &lhs, bigint<bits, signedness> const &rhs) {
+        using access = detail::limb_access;
+        auto const a = access::limbs(lhs);
+        auto const b = access::limbs(rhs);
+        auto difference = decltype(a){};
+        std::ignore = sub_limbs(difference.data(), a.data(), b.data(), difference.size());
+        auto result = bigint<bits, signedness>{};
+        access::assign(result, difference);
+        return result;
+    }
+
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] bigint<bits, signedness> multiply(bigint<bits, signedness> const &lhs, bigint<bits, signedness> const &rhs) {
+        using access = detail::limb_access;
+        auto const a = access::limbs(lhs);
+        auto const b = access::limbs(rhs);
+        auto product = decltype(a){};
+        mul_low_limbs(product.data(), a.data(), b.data(), product.size());
+        auto result = bigint<bits, signedness>{};
+        access::assign(result, product);
+        return result;
+    }
+
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] bigint<double_width<bits>, signedness> wide_multiply(bigint<bits, signedness> const &lhs,
+                                                                       bigint<bits, signedness> const &rhs) {
+        using access = detail::limb_access;
+        constexpr auto n = access::limb_count<bits, signedness>;
+        auto const a = access::magnitude<n>(lhs);
+        auto const b = access::magnitude<n>(rhs);
+        auto product = std::array<detail::limb, 2 * n>{};
+        mul_limbs(product.data(), a.data(), n, b.data(), n);
+        if (access::is_negative(lhs) != access::is_negative(rhs)) {
+            detail::negate(product);
+        }
+        auto result = bigint<double_width<bits>, signedness>{};
+        access::assign(result, product);
+        return result;
+    }
+
+    // bigint::mul_n with the dispatched multiplication.
+    template<BitWidth bits, Signedness signedness>
+    void mul_n(std::span<bigint<bits, signedness>> const out,
+               std::type_identity_t<std::span<bigint<bits, signedness> const>> const lhs,
+               std::type_identity_t<std::span<bigint<bits, signedness> const>> const rhs) {
+        if (lhs.size() != out.size() or rhs.size() != out.size()) {
+            throw std::invalid_argument("Batch operands must have the same size.");
+        }
+        for (auto const i: std::views::iota(0uz, out.size())) {
+            out[i] = multiply(lhs[i], rhs[i]);
+        }
+    }
+}
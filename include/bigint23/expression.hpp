@@ -0,0 +1,255 @@
+#pragma once
+
+// Opt-in expression templates for sums and differences of products. lazy(a) marks an operand;
+// +, - and * on it record the expression instead of computing it, and converting the result to
+// the bigint type evaluates the whole chain into one accumulator:
+//
+//     uint4096 r = lazy(a) * b + lazy(c) * d - e;
+//
+// adds a * b and c * d row by row into r and subtracts e, without a temporary for each partial
+// result. Products of products and products of sums evaluate their operands first. The
+// expression refers to its operands, so evaluate it in the statement that builds it. The results
+// are the same as with the wrapping operators of bigint.
+
+#include <bigint23/bigint.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+namespace bigint::expression {
+    enum class node_kind : std::uint8_t {
+        reference,
+        sum,
+        difference,
+        product,
+        negation
+    };
+
+    template<typename T>
+    struct reference;
+
+    template<typename Lhs, typename Rhs>
+    struct sum;
+
+    template<typename Lhs, typename Rhs>
+    struct difference;
+
+    template<typename Lhs, typename Rhs>
+    struct product;
+
+    template<typename Operand>
+    struct negation;
+
+    template<typename T>
+    inline constexpr bool is_bigint = false;
+
+    template<BitWidth bits, Signedness signedness>
+    inline constexpr bool is_bigint<bigint<bits, signedness>> = true;
+
+    template<typename T>
+    inline constexpr bool is_node = false;
+
+    template<typename T>
+    inline constexpr bool is_node<reference<T>> = true;
+
+    template<typename Lhs, typename Rhs>
+    inline constexpr bool is_node<sum<Lhs, Rhs>> = true;
+
+    template<typename Lhs, typename Rhs>
+    inline constexpr bool is_node<difference<Lhs, Rhs>> = true;
+
+    template<typename Lhs, typename Rhs>
+    inline constexpr bool is_node<product<Lhs, Rhs>> = true;
+
+    template<typename Operand>
+    inline constexpr bool is_node<negation<Operand>> = true;
+
+    template<typename T>
+    concept node = is_node<std::remove_cvref_t<T>>;
+
+    namespace detail {
+        using access = ::bigint::detail::limb_access;
+
+        template<typename T>
+        using limbs_of = decltype(access::limbs(std::declval<T const &>()));
+
+        // Adds (or subtracts) the value of an expression to an accumulator of its value type.
+        template<typename T, typename Node>
+        constexpr void accumulate(Node const &node, limbs_of<T> &accumulator, bool subtract);
+
+        template<typename T, typename Node>
+        [[nodiscard]] constexpr limbs_of<T> operand_limbs(Node const &node) {
+            if constexpr (Node::kind == node_kind::reference) {
+                return access::limbs(node.value);
+            } else {
+                auto result = limbs_of<T>{};
+                accumulate<T>(node, result, false);
+                return result;
+            }
+        }
+
+        template<typename T, typename Node>
+        constexpr void accumulate(Node const &node, limbs_of<T> &accumulator, bool const subtract) {
+            if constexpr (Node::kind == node_kind::reference) {
+                if (subtract) {
+                    ::bigint::detail::subtract_from(accumulator, access::limbs(node.value));
+                } else {
+                    ::bigint::detail::add_to(accumulator, access::limbs(node.value));
+                }
+            } else if constexpr (Node::kind == node_kind::negation) {
+                accumulate<T>(node.operand, accumulator, not subtract);
+            } else if constexpr (Node::kind == node_kind::sum) {
+                accumulate<T>(node.lhs, accumulator, subtract);
+                accumulate<T>(node.rhs, accumulator, subtract);
+            } else if constexpr (Node::kind == node_kind::difference) {
+                accumulate<T>(node.lhs, accumulator, subtract);
+                accumulate<T>(node.rhs, accumulator, not subtract);
+            } else {
+                ::bigint::detail::accumulate_product(operand_limbs<T>(node.lhs), operand_limbs<T>(node.rhs),
+                                                   accumulator, subtract);
+            }
+        }
+
+        // Operands of the operators: nodes as they are, bigints of the value type by reference.
+        template<typename T, typename Operand>
+        [[nodiscard]] constexpr auto wrap(Operand const &operand) {
+            if constexpr (is_node<Operand>) {
+                return operand;
+            } else {
+                return reference<T>{operand};
+            }
+        }
+    }
+
+    // The common base of all nodes: evaluation and conversion to the value type T.
+    template<typename T, typename Derived>
+    struct node_base {
+        using value_type = T;
+
+        [[nodiscard]] constexpr T evaluate() const {
+            auto accumulator = detail::limbs_of<T>{};
+            detail::accumulate<T>(static_cast<Derived const &>(*this), accumulator, false);
+            auto result = T{};
+            detail::access::assign(result, accumulator);
+            return result;
+        }
+
+        [[nodiscard]] constexpr operator T() const {
+            return evaluate();
+        }
+    };
+
+    template<typename T>
+    struct reference : node_base<T, reference<T>> {
+        static constexpr auto kind = node_kind::reference;
+
+        T const &value;
+
+        constexpr explicit reference(T const &value) : value{value} {
+        }
+    };
+
+    template<typename Lhs, typename Rhs>
+    struct sum : node_base<typename Lhs::value_type, sum<Lhs, Rhs>> {
+        static constexpr auto kind = node_kind::sum;
+
+        Lhs lhs;
+        Rhs rhs;
+
+        constexpr sum(Lhs lhs, Rhs rhs) : lhs{lhs}, rhs{rhs} {
+        }
+    };
+
+    template<typename Lhs, typename Rhs>
+    struct difference : node_base<typename Lhs::value_type, difference<Lhs, Rhs>> {
+        static constexpr auto kind = node_kind::difference;
+
+        Lhs lhs;
+        Rhs rhs;
+
+        constexpr difference(Lhs lhs, Rhs rhs) : lhs{lhs}, rhs{rhs} {
+        }
+    };
+
+    template<typename Lhs, typename Rhs>
+    struct product : node_base<typename Lhs::value_type, product<Lhs, Rhs>> {
+        static constexpr auto kind = node_kind::product;
+
+        Lhs lhs;
+        Rhs rhs;
+
+        constexpr product(Lhs lhs, Rhs rhs) : lhs{lhs}, rhs{rhs} {
+        }
+    };
+
+    template<typename Operand>
+    struct negation : node_base<typename Operand::value_type, negation<Operand>> {
+        static constexpr auto kind = node_kind::negation;
+
+        Operand operand;
+
+        constexpr explicit negation(Operand operand) : operand{operand} {
+        }
+    };
+
+    // Starts an expression at a bigint.
+    template<BitWidth bits, Signedness signedness>
+    [[nodiscard]] constexpr reference<bigint<bits, signedness>> lazy(bigint<bits, signedness> const &value) {
+        return reference<bigint<bits, signedness>>{value};
+    }
+
+    // Evaluates an expression; a bigint is returned as it is.
+    template<typename Operand>
+        requires node<Operand> or is_bigint<Operand>
+    [[nodiscard]] constexpr auto evaluate(Operand const &operand) {
+        if constexpr (node<Operand>) {
+            return operand.evaluate();
+        } else {
+            return operand;
+        }
+    }
+
+    // At least one side is a node, the other one a node or a bigint of the same value type.
+    template<typename Lhs, typename Rhs>
+    concept operands = (node<Lhs> and node<Rhs> and
+                        std::is_same_v<typename Lhs::value_type, typename Rhs::value_type>) or
+                       (node<Lhs> and std::is_same_v<Rhs, typename Lhs::value_type>) or
+                       (node<Rhs> and std::is_same_v<Lhs, typename Rhs::value_type>);
+
+    template<typename Lhs, typename Rhs>
+    using value_type_of = typename std::conditional_t<node<Lhs>, Lhs, Rhs>::value_type;
+
+    template<typename Lhs, typename Rhs>
+        requires operands<Lhs, Rhs>
+    [[nodiscard]] constexpr auto operator+(Lhs const &lhs, Rhs const &rhs) {
+        using T = value_type_of<Lhs, Rhs>;
+        auto left = detail::wrap<T>(lhs);
+        auto right = detail::wrap<T>(rhs);
+        return sum<decltype(left), decltype(right)>{left, right};
+    }
+
+    template<typename Lhs, typename Rhs>
+        requires operands<Lhs, Rhs>
+    [[nodiscard]] constexpr auto operator-(Lhs const &lhs, Rhs const &rhs) {
+        using T = value_type_of<Lhs, Rhs>;
+        auto left = detail::wrap<T>(lhs);
+        auto right = detail::wrap<T>(rhs);
+        return difference<decltype(left), decltype(right)>{left, right};
+    }
+
+    template<typename Lhs, typename Rhs>
+        requires operands<Lhs, Rhs>
+    [[nodiscard]] constexpr auto operator*(Lhs const &lhs, Rhs const &rhs) {
+        using T = value_type_of<Lhs, Rhs>;
+        auto left = detail::wrap<T>(lhs);
+        auto right = detail::wrap<T>(rhs);
+        return product<decltype(left), decltype(right)>{left, right};
+    }
+
+    template<node Operand>
+    [[nodiscard]] constexpr auto operator-(Operand const &operand) {
+        return negation<Operand>{operand};
+    }
+}
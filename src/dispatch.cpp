@@ -0,0 +1,289 @@
+#include <bigint23/dispatch.hpp>
+
+#include <algorithm>
+#include <tuple>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define bigint_HAS_ADX_KERNELS
+#endif
+
+namespace bigint::dispatch {
+    namespace {
+        using detail::limb;
+
+        struct kernel_table {
+            variant arithmetic;
+            limb (*add)(limb *, limb const *, limb const *, std::size_t) noexcept;
+            limb (*sub)(limb *, limb const *, limb const *, std::size_t) noexcept;
+            // out[0, size) += lhs[0, size) * rhs, returns the carry limb.
+            limb (*addmul_1)(limb *, limb const *, std::size_t, limb) noexcept;
+        };
+
+        limb add_generic(limb *out, limb const *lhs, limb const *rhs, std::size_t const size) noexcept {
+            auto carry = limb{0};
+            for (auto const i: std::views::iota(0uz, size)) {
+                out[i] = detail::add_with_carry(lhs[i], rhs[i], carry);
+            }
+            return carry;
+        }
+
+        limb sub_generic(limb *out, limb const *lhs, limb const *rhs, std::size_t const size) noexcept {
+            auto borrow = limb{0};
+            for (auto const i: std::views::iota(0uz, size)) {
+                out[i] = detail::sub_with_borrow(lhs[i], rhs[i], borrow);
+            }
+            return borrow;
+        }
+
+        limb addmul_1_generic(limb *out, limb const *lhs, std::size_t const size, limb const rhs) noexcept {
+            auto carry = limb{0};
+            for (auto const i: std::views::iota(0uz, size)) {
+                auto high = limb{0};
+                auto const low = detail::multiply_wide(lhs[i], rhs, high);
+                auto first = limb{0};
+                auto second = limb{0};
+                out[i] = detail::add_with_carry(out[i], low, first);
+                out[i] = detail::add_with_carry(out[i], carry, second);
+                carry = high + first + second;
+            }
+            return carry;
+        }
+
+#if defined(bigint_HAS_ADX_KERNELS)
+        // The loops below count in rcx and step with lea and jrcxz, which leave the flags alone, so
+        // the carry chains run through the whole loop. Each first handles size % 4 limbs one at a
+        // time and then the rest four at a time. GCC does not emit adcx and adox from the
+        // intrinsics, hence the inline assembly.
+
+        limb add_adx(limb *out, limb const *lhs, limb const *rhs, std::size_t const size) noexcept {
+            auto count = size & 3;
+            auto const quads = size >> 2;
+            limb value;
+            limb carry;
+            asm volatile(
+                "xor %k[carry], %k[carry]\n\t"
+                "jrcxz 2f\n\t"
+                "1:\n\t"
+                "mov (%[lhs]), %[value]\n\t"
+                "adcx (%[rhs]), %[value]\n\t"
+                "mov %[value], (%[out])\n\t"
+                "lea 8(%[lhs]), %[lhs]\n\t"
+                "lea 8(%[rhs]), %[rhs]\n\t"
+                "lea 8(%[out]), %[out]\n\t"
+                "lea -1(%[count]), %[count]\n\t"
+                "jrcxz 2f\n\t"
+                "jmp 1b\n\t"
+                "2:\n\t"
+                "mov %[quads], %[count]\n\t"
+                "jrcxz 4f\n\t"
+                "3:\n\t"
+                "mov (%[lhs]), %[value]\n\t"
+                "adcx (%[rhs]), %[value]\n\t"
+                "mov %[value], (%[out])\n\t"
+                "mov 8(%[lhs]), %[value]\n\t"
+                "adcx 8(%[rhs]), %[value]\n\t"
+                "mov %[value], 8(%[out])\n\t"
+                "mov 16(%[lhs]), %[value]\n\t"
+                "adcx 16(%[rhs]), %[value]\n\t"
+                "mov %[value], 16(%[out])\n\t"
+                "mov 24(%[lhs]), %[value]\n\t"
+                "adcx 24(%[rhs]), %[value]\n\t"
+                "mov %[value], 24(%[out])\n\t"
+                "lea 32(%[lhs]), %[lhs]\n\t"
+                "lea 32(%[rhs]), %[rhs]\n\t"
+                "lea 32(%[out]), %[out]\n\t"
+                "lea -1(%[count]), %[count]\n\t"
+                "jrcxz 4f\n\t"
+                "jmp 3b\n\t"
+                "4:\n\t"
+                "setc %b[carry]\n\t"
+                : [carry] "=&r"(carry), [value] "=&r"(value), [lhs] "+r"(lhs), [rhs] "+r"(rhs), [out] "+r"(out),
+                  [count] "+c"(count)
+                : [quads] "r"(quads)
+                : "cc", "memory");
+            return carry;
+        }
+
+        limb sub_adx(limb *out, limb const *lhs, limb const *rhs, std::size_t const size) noexcept {
+            auto count = size & 3;
+            auto const quads = size >> 2;
+            limb value;
+            limb borrow;
+            asm volatile(
+                "xor %k[borrow], %k[borrow]\n\t"
+                "jrcxz 2f\n\t"
+                "1:\n\t"
+                "mov (%[lhs]), %[value]\n\t"
+                "sbb (%[rhs]), %[value]\n\t"
+                "mov %[value], (%[out])\n\t"
+                "lea 8(%[lhs]), %[lhs]\n\t"
+                "lea 8(%[rhs]), %[rhs]\n\t"
+                "lea 8(%[out]), %[out]\n\t"
+                "lea -1(%[count]), %[count]\n\t"
+                "jrcxz 2f\n\t"
+                "jmp 1b\n\t"
+                "2:\n\t"
+                "mov %[quads], %[count]\n\t"
+                "jrcxz 4f\n\t"
+                "3:\n\t"
+                "mov (%[lhs]), %[value]\n\t"
+                "sbb (%[rhs]), %[value]\n\t"
+                "mov %[value], (%[out])\n\t"
+                "mov 8(%[lhs]), %[value]\n\t"
+                "sbb 8(%[rhs]), %[value]\n\t"
+                "mov %[value], 8(%[out])\n\t"
+                "mov 16(%[lhs]), %[value]\n\t"
+                "sbb 16(%[rhs]), %[value]\n\t"
+                "mov %[value], 16(%[out])\n\t"
+                "mov 24(%[lhs]), %[value]\n\t"
+                "sbb 24(%[rhs]), %[value]\n\t"
+                "mov %[value], 24(%[out])\n\t"
+                "lea 32(%[lhs]), %[lhs]\n\t"
+                "lea 32(%[rhs]), %[rhs]\n\t"
+                "lea 32(%[out]), %[out]\n\t"
+                "lea -1(%[count]), %[count]\n\t"
+                "jrcxz 4f\n\t"
+                "jmp 3b\n\t"
+                "4:\n\t"
+                "setc %b[borrow]\n\t"
+                : [borrow] "=&r"(borrow), [value] "=&r"(value), [lhs] "+r"(lhs), [rhs] "+r"(rhs), [out] "+r"(out),
+                  [count] "+c"(count)
+                : [quads] "r"(quads)
+                : "cc", "memory");
+            return borrow;
+        }
+
+        // mulx leaves the flags alone, so the high halves are added with adox (overflow flag) and
+        // the existing limbs with adcx (carry flag) as two independent carry chains.
+        limb addmul_1_adx(limb *out, limb const *lhs, std::size_t const size, limb const rhs) noexcept {
+            auto count = size & 3;
+            auto const quads = size >> 2;
+            limb carry;
+            limb low;
+            limb high;
+            asm volatile(
+                "xor %k[carry], %k[carry]\n\t"
+                "jrcxz 2f\n\t"
+                "1:\n\t"
+                "mulx (%[lhs]), %[low], %[high]\n\t"
+                "adox %[carry], %[low]\n\t"
+                "mov %[high], %[carry]\n\t"
+                "adcx (%[out]), %[low]\n\t"
+                "mov %[low], (%[out])\n\t"
+                "lea 8(%[lhs]), %[lhs]\n\t"
+                "lea 8(%[out]), %[out]\n\t"
+                "lea -1(%[count]), %[count]\n\t"
+                "jrcxz 2f\n\t"
+                "jmp 1b\n\t"
+                "2:\n\t"
+                "mov %[quads], %[count]\n\t"
+                "jrcxz 4f\n\t"
+                "3:\n\t"
+                "mulx (%[lhs]), %[low], %[high]\n\t"
+                "adox %[carry], %[low]\n\t"
+                "adcx (%[out]), %[low]\n\t"
+                "mov %[low], (%[out])\n\t"
+                "mulx 8(%[lhs]), %[low], %[carry]\n\t"
+                "adox %[high], %[low]\n\t"
+                "adcx 8(%[out]), %[low]\n\t"
+                "mov %[low], 8(%[out])\n\t"
+                "mulx 16(%[lhs]), %[low], %[high]\n\t"
+                "adox %[carry], %[low]\n\t"
+                "adcx 16(%[out]), %[low]\n\t"
+                "mov %[low], 16(%[out])\n\t"
+                "mulx 24(%[lhs]), %[low], %[carry]\n\t"
+                "adox %[high], %[low]\n\t"
+                "adcx 24(%[out]), %[low]\n\t"
+                "mov %[low], 24(%[out])\n\t"
+                "lea 32(%[lhs]), %[lhs]\n\t"
+                "lea 32(%[out]), %[out]\n\t"
+                "lea -1(%[count]), %[count]\n\t"
+                "jrcxz 4f\n\t"
+                "jmp 3b\n\t"
+                "4:\n\t"
+                "mov $0, %k[low]\n\t"
+                "adox %[low], %[carry]\n\t"
+                "adcx %[low], %[carry]\n\t"
+                : [carry] "=&r"(carry), [low] "=&r"(low), [high] "=&r"(high), [lhs] "+r"(lhs), [out] "+r"(out),
+                  [count] "+c"(count)
+                : "d"(rhs), [quads] "r"(quads)
+                : "cc", "memory");
+            return carry;
+        }
+#endif
+
+        kernel_table const &kernels() {
+            static auto const table = [] {
+#if defined(bigint_HAS_ADX_KERNELS)
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("bmi2") and __builtin_cpu_supports("adx")) {
+                    return kernel_table{variant::bmi2_adx, add_adx, sub_adx, addmul_1_adx};
+                }
+#endif
+                return kernel_table{variant::generic, add_generic, sub_generic, addmul_1_generic};
+            }();
+            return table;
+        }
+
+        variant batch_variant() {
+#if defined(bigint_HAS_BATCH_SIMD)
+            switch (detail::detect_batch_isa()) {
+                case detail::batch_isa::avx512:
+                    return variant::avx512;
+                case detail::batch_isa::avx2:
+                    return variant::avx2;
+                case detail::batch_isa::scalar:
+                    break;
+            }
+#endif
+            return variant::generic;
+        }
+    }
+
+    selection selected() noexcept {
+        static auto const batch = batch_variant();
+        return {kernels().arithmetic, batch};
+    }
+
+    std::string_view to_string(variant const value) noexcept {
+        switch (value) {
+            case variant::generic:
+                return "generic";
+            case variant::bmi2_adx:
+                return "bmi2_adx";
+            case variant::avx2:
+                return "avx2";
+            case variant::avx512:
+                return "avx512";
+        }
+        return "unknown";
+    }
+
+    detail::limb add_limbs(detail::limb *out, detail::limb const *lhs, detail::limb const *rhs,
+                           std::size_t const size) noexcept {
+        return kernels().add(out, lhs, rhs, size);
+    }
+
+    detail::limb sub_limbs(detail::limb *out, detail::limb const *lhs, detail::limb const *rhs,
+                           std::size_t const size) noexcept {
+        return kernels().sub(out, lhs, rhs, size);
+    }
+
+    void mul_limbs(detail::limb *out, detail::limb const *lhs, std::size_t const lhs_size,
+                   detail::limb const *rhs, std::size_t const rhs_size) noexcept {
+        auto const addmul_1 = kernels().addmul_1;
+        std::fill_n(out, lhs_size + rhs_size, detail::limb{0});
+        for (auto const i: std::views::iota(0uz, rhs_size)) {
+            out[i + lhs_size] = addmul_1(out + i, lhs, lhs_size, rhs[i]);
+        }
+    }
+
+    void mul_low_limbs(detail::limb *out, detail::limb const *lhs, detail::limb const *rhs,
+                       std::size_t const size) noexcept {
+        auto const addmul_1 = kernels().addmul_1;
+        std::fill_n(out, size, detail::limb{0});
+        for (auto const i: std::views::iota(0uz, size)) {
+            std::ignore = addmul_1(out + i, lhs, size - i, rhs[i]);
+        }
+    }
+}
@@ -4,6 +4,9 @@
 
 #include <bigint23/bigint.hpp>
 #include <gtest/gtest.h>
+#include <cstdint>
+#include <stdexcept>
+#include <tuple>
 
 namespace {
     TEST(bigint23, addition_with_integral_test) {
@@ -164,6 +167,38 @@ namespace {
         ASSERT_EQ(c >> 64, 0xFFFFFFFF);
     }
 
+    TEST(bigint23, shift_count_types_test) {
+        using i200 = bigint::bigint<bigint::BitWidth{200}, bigint::Signedness::Signed>;
+        using u256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+        auto const a = (u256{0x8000000000000001ull} << 64) | u256{0xc000000000000003ull};
+        ASSERT_EQ(a << 1, (u256{1} << 128) | (u256{3} << 64) | u256{0x8000000000000006ull});
+        ASSERT_EQ(a >> 1, (u256{0x4000000000000000ull} << 64) | u256{0xe000000000000001ull});
+        ASSERT_EQ(a << std::uint8_t{130}, (u256{0xc000000000000003ull} << 130) | (u256{1} << 194));
+        ASSERT_EQ(a >> 64l, u256{0x8000000000000001ull});
+        ASSERT_EQ(a << u256{64}, a << 64);
+        ASSERT_EQ(a >> i200{127}, u256{1});
+        ASSERT_EQ(a << (u256{1} << 200), 0);
+        ASSERT_EQ(a << 256u, 0);
+        ASSERT_THROW(std::ignore = a << -1, std::invalid_argument);
+        ASSERT_THROW(std::ignore = a >> i200{-5}, std::invalid_argument);
+
+        // Arithmetic right shifts of a width with a partial top limb.
+        auto const b = -(i200{1} << 150);
+        ASSERT_EQ(b >> 1, -(i200{1} << 149));
+        ASSERT_EQ(b >> 140, i200{-1024});
+        ASSERT_EQ(b >> 199, i200{-1});
+        ASSERT_EQ(b >> 1000ull, i200{-1});
+        ASSERT_EQ(b << 49, i200{1} << 199);
+
+        auto c = u256{1};
+        for (auto i = 0; i < 255; ++i) {
+            c <<= 1;
+        }
+        ASSERT_EQ(c, u256{1} << 255);
+        c >>= u256{255};
+        ASSERT_EQ(c, 1);
+    }
+
     TEST(bigint23, increment_test) {
         using i32 = bigint::bigint<bigint::BitWidth{32}, bigint::Signedness::Signed>;
         i32 a = 42;
@@ -199,4 +234,182 @@ namespace {
         constexpr i8 a = "42";
         ASSERT_EQ(+a, static_cast<int8_t>(42));
     }
+
+    TEST(bigint23, multi_limb_test) {
+        using u256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+        using u72 = bigint::bigint<bigint::BitWidth{72}, bigint::Signedness::Unsigned>;
+        using i72 = bigint::bigint<bigint::BitWidth{72}, bigint::Signedness::Signed>;
+        u256 const a = "0xffffffffffffffffffffffffffffffff";
+        u256 const b = "0x100000000000000000000000000000000";
+        ASSERT_EQ(a + 1, b);
+        ASSERT_EQ(b - 1, a);
+        ASSERT_EQ(a * a, u256{"0xfffffffffffffffffffffffffffffffe00000000000000000000000000000001"});
+        ASSERT_EQ(a * a / a, a);
+        ASSERT_EQ((a * a + 42) % a, 42);
+        ASSERT_EQ(b >> 65, u256{"0x8000000000000000"});
+        ASSERT_EQ(a << 100, u256{"0xffffffffffffffffffffffffffffffff0000000000000000000000000"});
+        u72 const c = "0xffffffffffffffffff";
+        ASSERT_EQ(c + 1, 0);
+        ASSERT_EQ(~c, 0);
+        ASSERT_EQ(c >> 64, 0xff);
+        i72 const d = -1;
+        ASSERT_EQ(d >> 70, -1);
+        ASSERT_EQ(d * d, 1);
+        i72 const e = "0x800000000000000000";
+        ASSERT_LT(e, 0);
+        ASSERT_EQ(e / -1, e);
+        ASSERT_THROW(std::ignore = u72{"0x1000000000000000000"}, std::overflow_error);
+    }
+
+    TEST(bigint23, multi_limb_division_test) {
+        using u512 = bigint::bigint<bigint::BitWidth{512}, bigint::Signedness::Unsigned>;
+        using i256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Signed>;
+        u512 const a = "0x7fffffffffffffff800000000000000000000000000000000000000000000000";
+        u512 const b = "0x800000000000000000000000000000000000000000000001";
+        ASSERT_EQ(a / b, u512{"0xfffffffffffffffe"});
+        ASSERT_EQ(a % b, u512{"0x7fffffffffffffffffffffffffffffff0000000000000002"});
+        ASSERT_EQ(a / b * b + a % b, a);
+        u512 const c = "1000000000000000000000000000000000000000000000000000000000000000000000";
+        ASSERT_EQ(c / 10000000000000000000ull, u512{"100000000000000000000000000000000000000000000000000"});
+        ASSERT_EQ((c + 12345) % 10000000000000000000ull, 12345);
+        i256 const d = "-340282366920938463463374607431768211457";
+        i256 const e = "18446744073709551616";
+        ASSERT_EQ(d / e, i256{"-18446744073709551616"});
+        ASSERT_EQ(d % e, -1);
+    }
+
+    TEST(bigint23, karatsuba_multiply_test) {
+        using u4096 = bigint::bigint<bigint::BitWidth{4096}, bigint::Signedness::Unsigned>;
+        using i8192 = bigint::bigint<bigint::BitWidth{8192}, bigint::Signedness::Signed>;
+        auto const a = (u4096{1} << 4000) - 1;
+        ASSERT_EQ(a * a + (u4096{1} << 4001), 1);
+        ASSERT_EQ(a * ~u4096{0}, -a);
+
+        auto const power = std::string("1") + std::string(600, '0');
+        i8192 const b(power);
+        i8192 const c = -(b - 1);
+        ASSERT_EQ((b + 1) * c, -(i8192{std::string("1") + std::string(1200, '0')} - 1));
+        ASSERT_EQ((b + 1) * c / c, b + 1);
+    }
+
+    TEST(bigint23, toom3_multiply_test) {
+        using u98304 = bigint::bigint<bigint::BitWidth{98304}, bigint::Signedness::Unsigned>;
+        auto const a = (u98304{1} << 90000) - 1;
+        ASSERT_EQ(a * a + (u98304{1} << 90001), 1);
+        auto const b = (u98304{1} << 49000) + 12345;
+        ASSERT_EQ(b * (b - 24690), (u98304{1} << 98000) - 12345ull * 12345ull);
+    }
+
+    TEST(bigint23, ntt_multiply_test) {
+        using bigint::detail::limb;
+        constexpr auto n = std::size_t{1100};
+        auto lhs = std::array<limb, n>{};
+        auto rhs = std::array<limb, n>{};
+        auto state = limb{1};
+        for (auto i = 0uz; i < n; ++i) {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            lhs[i] = i % 7 == 0 ? ~limb{0} : state;
+            rhs[i] = i % 5 == 0 ? 0 : state >> 3;
+        }
+        auto expected = std::array<limb, 2 * n>{};
+        auto product = std::array<limb, 2 * n>{};
+        bigint::detail::multiply_schoolbook(lhs, rhs, expected);
+        bigint::detail::multiply_ntt(lhs, rhs, product, bigint::detail::sequential_fork{});
+        ASSERT_EQ(product, expected);
+        bigint::detail::multiply_toom3(lhs, rhs, product);
+        ASSERT_EQ(product, expected);
+
+        // The same array on both sides takes the squaring path; all-ones limbs give the largest
+        // convolution coefficients.
+        lhs.fill(~limb{0});
+        bigint::detail::multiply_schoolbook(lhs, lhs, expected);
+        bigint::detail::multiply_ntt(lhs, lhs, product, bigint::detail::sequential_fork{});
+        ASSERT_EQ(product, expected);
+
+        // A short operand is multiplied limb by limb.
+        rhs.fill(0);
+        rhs[3] = 12345;
+        bigint::detail::multiply_schoolbook(lhs, rhs, expected);
+        bigint::detail::multiply_ntt(lhs, rhs, product, bigint::detail::sequential_fork{});
+        ASSERT_EQ(product, expected);
+
+        using u131072 = bigint::bigint<bigint::BitWidth{131072}, bigint::Signedness::Unsigned>;
+        using i65536 = bigint::bigint<bigint::BitWidth{65536}, bigint::Signedness::Signed>;
+        using i131072 = bigint::bigint<bigint::BitWidth{131072}, bigint::Signedness::Signed>;
+        auto const a = (u131072{1} << 130000) - 1;
+        ASSERT_EQ(a * a + (u131072{1} << 130001), 1);
+        auto const b = (u131072{1} << 65000) + 12345;
+        ASSERT_EQ(b * (b - 24690), (u131072{1} << 130000) - 12345ull * 12345ull);
+        auto const c = -((i65536{1} << 65000) - 1);
+        auto const square = (i131072{1} << 130000) - (i131072{1} << 65001) + 1;
+        ASSERT_EQ(bigint::wide_multiply(c, c), square);
+        ASSERT_EQ(bigint::wide_multiply(c, -c), -square);
+    }
+
+    TEST(bigint23, wide_multiply_test) {
+        using u128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned>;
+        using u256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+        using i72 = bigint::bigint<bigint::BitWidth{72}, bigint::Signedness::Signed>;
+        using i144 = bigint::bigint<bigint::BitWidth{144}, bigint::Signedness::Signed>;
+        auto const a = ~u128{0};
+        ASSERT_EQ(bigint::wide_multiply(a, a), u256{"0xfffffffffffffffffffffffffffffffe00000000000000000000000000000001"});
+        ASSERT_EQ(bigint::mul_hi(a, a), u128{"0xfffffffffffffffffffffffffffffffe"});
+        ASSERT_EQ(bigint::mul_hi(a, u128{2}), 1);
+
+        i72 const minimum = "0x800000000000000000";
+        ASSERT_EQ(bigint::wide_multiply(minimum, minimum), i144{1} << 142);
+        ASSERT_EQ(bigint::wide_multiply(minimum, i72{3}), i144{minimum} * 3);
+        ASSERT_EQ(bigint::mul_hi(minimum, i72{3}), -2);
+        ASSERT_EQ(bigint::mul_hi(i72{-1}, i72{1}), -1);
+        ASSERT_EQ(bigint::mul_hi(i72{-5}, i72{-7}), 0);
+    }
+
+    // Built-in operands take single limb paths; they must agree with the operands widened to a bigint.
+    TEST(bigint23, single_limb_operand_test) {
+        using i4096 = bigint::bigint<bigint::BitWidth{4096}, bigint::Signedness::Signed>;
+        using u200 = bigint::bigint<bigint::BitWidth{200}, bigint::Signedness::Unsigned>;
+        using i72 = bigint::bigint<bigint::BitWidth{72}, bigint::Signedness::Signed>;
+
+        auto const big = -((i4096{1} << 4000) - 12345);
+        for (auto const value: {std::int64_t{10}, std::int64_t{-7}, std::int64_t{1'000'000'007}, INT64_MIN}) {
+            auto const wide = i4096{value};
+            ASSERT_EQ(big + value, big + wide);
+            ASSERT_EQ(big - value, big - wide);
+            ASSERT_EQ(big * value, big * wide);
+            ASSERT_EQ(big / value, big / wide);
+            ASSERT_EQ(big % value, big % wide);
+            auto const [quotient, remainder] = divmod(big, value);
+            ASSERT_EQ(quotient, big / wide);
+            ASSERT_EQ(remainder, big % wide);
+        }
+
+        // Carries and borrows run through the whole value and wrap at the width.
+        auto const all_ones = ~u200{0};
+        ASSERT_EQ(all_ones + 1u, 0);
+        ASSERT_EQ(u200{0} - 1, all_ones);
+        ASSERT_EQ(all_ones * 2, all_ones - 1);
+        ASSERT_EQ(u200{5} + (-7), all_ones - 1);
+        ASSERT_EQ(all_ones * UINT64_MAX, all_ones - UINT64_MAX + 1);
+        ASSERT_EQ(all_ones / 3, all_ones / u200{3});
+        ASSERT_EQ(all_ones % 1'000'000'007u, all_ones % u200{1'000'000'007u});
+        // An unsigned bigint divides by the two's complement of a negative operand.
+        ASSERT_EQ(all_ones / -1, 1);
+        ASSERT_EQ(all_ones % -2, 1);
+        auto const [quotient, remainder] = divmod(all_ones - 5, -2);
+        ASSERT_EQ(quotient, (all_ones - 5) / -2);
+        ASSERT_EQ(remainder, (all_ones - 5) % -2);
+
+        auto const minimum = i72{1} << 71;
+        ASSERT_EQ(minimum * -1, minimum);
+        ASSERT_EQ(minimum / -1, minimum);
+        ASSERT_EQ(minimum - 1, ~minimum);
+        ASSERT_EQ(i72{-100} / 7, -14);
+        ASSERT_EQ(i72{-100} % 7, -2);
+        ASSERT_EQ(i72{100} % -7, 2);
+        ASSERT_THROW(std::ignore = big / 0, std::overflow_error);
+        ASSERT_THROW(std::ignore = divmod(big, 0u), std::overflow_error);
+
+        static_assert((u200{1} << 199) / 10 * 10 + (u200{1} << 199) % 10 == u200{1} << 199);
+        static_assert(i4096{-12345} * 3 - 1 == -37036);
+    }
 }
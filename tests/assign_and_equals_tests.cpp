@@ -4,6 +4,13 @@
 
 #include <bigint23/bigint.hpp>
 #include <gtest/gtest.h>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 namespace {
     TEST(bigint23, assign_and_equals_8bit_test) {
@@ -190,4 +197,159 @@ namespace {
         ak = std::string("1234");
         ASSERT_EQ(ak, 1234);
     }
+
+    TEST(bigint23, assign_from_long_string_test) {
+        using uint1024_t = bigint::bigint<bigint::BitWidth{1024}, bigint::Signedness::Unsigned>;
+        using uint72_t = bigint::bigint<bigint::BitWidth{72}, bigint::Signedness::Unsigned>;
+        using int256_t = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Signed>;
+
+        // 2^1024 - 1 in every base, long enough for several chunks and runs of eight digits.
+        auto const maximum = ~uint1024_t{0};
+        uint1024_t const a = "1797693134862315907729305190789024733617976978942306572734300811577326758055009631327084773224075360"
+                             "2112011387987139335765878976881441662249284743063947412437776789342486548527630221960124609411945308"
+                             "2952085005768838150682342462881473913110540827237163350510684586298239947245938479716304835356329624224137215";
+        ASSERT_EQ(a, maximum);
+        ASSERT_EQ(uint1024_t{"0x" + std::string(256, 'f')}, maximum);
+        ASSERT_EQ(uint1024_t{"0x" + std::string(256, 'F')}, maximum);
+        ASSERT_EQ(uint1024_t{"0b" + std::string(1024, '1')}, maximum);
+        ASSERT_EQ(uint1024_t{"01" + std::string(341, '7')}, maximum);
+        ASSERT_EQ(uint1024_t{"0x" + std::string(300, '0') + "1"}, uint1024_t{1});
+        ASSERT_EQ(uint1024_t{"0x1" + std::string(255, '0')}, uint1024_t{1} << 1020);
+        ASSERT_EQ(uint1024_t{"0b1" + std::string(1000, '0')}, uint1024_t{1} << 1000);
+        ASSERT_EQ(uint1024_t{"0xdead'beef cafe'babe 0123'4567 89ab'cdef"},
+                  (uint1024_t{0xdeadbeefcafebabe} << 64) | uint1024_t{0x0123456789abcdef});
+        ASSERT_EQ(uint1024_t{"1'000'000'000'000'000'000'000'000'000"},
+                  uint1024_t{1'000'000'000'000'000} * uint1024_t{1'000'000'000'000});
+        ASSERT_EQ(int256_t{"-1234567890123456789012345678901234567890"}, -int256_t{"0x3a0c92075c0dbf3b8acbc5f96ce3f0ad2"});
+
+        ASSERT_THROW(std::ignore = uint1024_t{"0x1" + std::string(256, '0')}, std::overflow_error);
+        ASSERT_THROW(std::ignore = uint1024_t{"0b1" + std::string(1024, '0')}, std::overflow_error);
+        ASSERT_THROW(std::ignore = uint1024_t{"02" + std::string(341, '7')}, std::overflow_error);
+        ASSERT_THROW(std::ignore = uint1024_t{std::string(309, '9')}, std::overflow_error);
+        ASSERT_THROW(std::ignore = uint72_t{"0x1" + std::string(18, '0')}, std::overflow_error);
+        ASSERT_THROW(std::ignore = uint72_t{"4722366482869645213696"}, std::overflow_error);
+        ASSERT_EQ(uint72_t{"4722366482869645213695"}, ~uint72_t{0});
+        ASSERT_THROW(std::ignore = uint1024_t{"0x" + std::string(20, 'f') + "g" + std::string(20, 'f')}, std::runtime_error);
+        ASSERT_THROW(std::ignore = uint1024_t{"0b" + std::string(20, '1') + "2" + std::string(20, '1')}, std::runtime_error);
+        ASSERT_THROW(std::ignore = uint1024_t{std::string(20, '1') + "a" + std::string(20, '1')}, std::runtime_error);
+        // Invalid characters are reported even when the digits before them already overflow.
+        auto const message = [] {
+            try {
+                std::ignore = uint72_t{std::string(40, '9') + "x"};
+            } catch (std::exception const &error) {
+                return std::string{error.what()};
+            }
+            return std::string{};
+        }();
+        ASSERT_EQ(message, "Invalid digit in input string.");
+    }
+
+    // Wider than bigint_DECIMAL_PARSE_THRESHOLD limbs, so long decimal strings are split.
+    TEST(bigint23, assign_from_wide_decimal_string_test) {
+        using uint32768_t = bigint::bigint<bigint::BitWidth{32768}, bigint::Signedness::Unsigned>;
+        using int32768_t = bigint::bigint<bigint::BitWidth{32768}, bigint::Signedness::Signed>;
+        auto const decimal = [](auto const &value) {
+            auto stream = std::ostringstream{};
+            stream << value;
+            return stream.str();
+        };
+
+        auto value = uint32768_t{1};
+        for (auto i = 0u; i < 511; ++i) {
+            value = value * uint32768_t{0xfedcba9876543211} + uint32768_t{i % 3 == 0 ? 0 : ~0ull};
+        }
+        auto const text = decimal(value);
+        ASSERT_EQ(uint32768_t{text}, value);
+        ASSERT_EQ(uint32768_t{text.substr(0, 5000) + std::string(text.size() - 5000, '0')},
+                  value - value % uint32768_t{"1" + std::string(text.size() - 5000, '0')});
+
+        auto grouped = std::string{};
+        for (auto i = 0uz; i < text.size(); ++i) {
+            grouped += text[i];
+            if ((text.size() - i) % 3 == 1 and i + 1 < text.size()) {
+                grouped += '\'';
+            }
+        }
+        ASSERT_EQ(uint32768_t{grouped}, value);
+
+        auto parsed = uint32768_t{};
+        auto const [ptr, error] = from_chars(text.data(), text.data() + text.size(), parsed);
+        ASSERT_EQ(error, std::errc{});
+        ASSERT_EQ(ptr, text.data() + text.size());
+        ASSERT_EQ(parsed, value);
+        auto const padded = std::string(5000, '0') + text;
+        parsed = uint32768_t{};
+        ASSERT_EQ(from_chars(padded.data(), padded.data() + padded.size(), parsed).ec, std::errc{});
+        ASSERT_EQ(parsed, value);
+
+        auto const half = int32768_t{value >> 1};
+        ASSERT_EQ(int32768_t{"-" + decimal(half)}, -half);
+
+        // 2^32768 - 1 ends in 5, so adding one only changes the last digit.
+        auto limit = decimal(~uint32768_t{0});
+        ASSERT_EQ(uint32768_t{limit}, ~uint32768_t{0});
+        limit.back() = '6';
+        ASSERT_THROW(std::ignore = uint32768_t{limit}, std::overflow_error);
+        ASSERT_EQ(from_chars(limit.data(), limit.data() + limit.size(), parsed).ec, std::errc::result_out_of_range);
+        ASSERT_THROW(std::ignore = uint32768_t{"1" + std::string(10000, '0')}, std::overflow_error);
+        ASSERT_THROW(std::ignore = uint32768_t{text.substr(0, 6000) + "a" + text.substr(6000)}, std::runtime_error);
+    }
+
+    // Values occupy whole limbs: the width is rounded up to a multiple of 64 bits.
+    TEST(bigint23, storage_size_test) {
+        static_assert(sizeof(bigint::bigint<bigint::BitWidth{8}, bigint::Signedness::Signed>) == 8);
+        static_assert(sizeof(bigint::bigint<bigint::BitWidth{16}, bigint::Signedness::Unsigned>) == 8);
+        static_assert(sizeof(bigint::bigint<bigint::BitWidth{64}, bigint::Signedness::Unsigned>) == 8);
+        static_assert(sizeof(bigint::bigint<bigint::BitWidth{72}, bigint::Signedness::Signed>) == 16);
+        static_assert(sizeof(bigint::bigint<bigint::BitWidth{136}, bigint::Signedness::Unsigned>) == 24);
+        static_assert(sizeof(bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>) == 32);
+        static_assert(alignof(bigint::bigint<bigint::BitWidth{72}, bigint::Signedness::Signed>) == alignof(std::uint64_t));
+
+        // The unused high bytes of the top limb stay zero, also after wrapping and negation.
+        using int72_t = bigint::bigint<bigint::BitWidth{72}, bigint::Signedness::Signed>;
+        auto const value = int72_t{-1};
+        std::uint64_t limbs[2];
+        std::memcpy(limbs, &value, sizeof(value));
+        ASSERT_EQ(limbs[std::endian::native == std::endian::little ? 1 : 0], 0xffu);
+    }
+
+    TEST(bigint23, assign_trivially_copyable_test) {
+        using int72_t = bigint::bigint<bigint::BitWidth{72}, bigint::Signedness::Signed>;
+        using uint256_t = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+        static_assert(std::is_trivially_copyable_v<int72_t> and std::is_standard_layout_v<int72_t>);
+        static_assert(std::is_trivially_copyable_v<uint256_t> and std::is_standard_layout_v<uint256_t>);
+        static_assert(std::is_trivially_copy_assignable_v<uint256_t> and std::is_trivially_destructible_v<uint256_t>);
+
+        auto values = std::vector<uint256_t>{};
+        for (auto i = 0u; i < 100; ++i) {
+            values.push_back((uint256_t{i} << 200) | uint256_t{i});
+        }
+        auto copies = std::vector<uint256_t>(values.size());
+        std::memcpy(copies.data(), values.data(), values.size() * sizeof(uint256_t));
+        ASSERT_EQ(copies, values);
+
+        // Assignments from other types overwrite every limb, including the sign extension.
+        auto value = int72_t{-1};
+        value = 5u;
+        ASSERT_EQ(value, 5);
+        value = bigint::bigint<bigint::BitWidth{16}, bigint::Signedness::Signed>{std::int16_t{-300}};
+        ASSERT_EQ(value, -300);
+        value = "-16";
+        ASSERT_EQ(value, -16);
+        value = std::string{"2361183241434822606847"};
+        ASSERT_EQ(value, ~int72_t{0} ^ (int72_t{1} << 71));
+        auto const unchanged = value;
+        ASSERT_THROW(value = "12x", std::runtime_error);
+        ASSERT_EQ(value, unchanged);
+
+        // Without placement new the assignments work during constant evaluation as well.
+        constexpr auto assigned = [] {
+            auto result = uint256_t{};
+            result = 7;
+            result = result + uint256_t{"0x10"};
+            result = std::string_view{"1000"};
+            return result;
+        }();
+        static_assert(assigned == 1000);
+    }
 }
@@ -0,0 +1,92 @@
+#include <bigint23/bigint.hpp>
+#include <gtest/gtest.h>
+#include "test_values.hpp"
+#include <array>
+#include <vector>
+
+namespace {
+    using test_values::make_values;
+    using uint256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+    using int512 = bigint::bigint<bigint::BitWidth{512}, bigint::Signedness::Signed>;
+    using int72 = bigint::bigint<bigint::BitWidth{72}, bigint::Signedness::Signed>;
+
+    TEST(bigint23, add_n_test) {
+        auto const lhs = make_values<uint256>(37, 1);
+        auto rhs = make_values<uint256>(37, 2);
+        rhs[3] = ~lhs[3] + 1;
+        rhs[4] = ~lhs[4];
+        auto out = std::vector<uint256>(37);
+        bigint::add_n(std::span{out}, lhs, rhs);
+        for (auto i = 0uz; i < out.size(); ++i) {
+            ASSERT_EQ(out[i], lhs[i] + rhs[i]);
+        }
+        ASSERT_EQ(out[3], 0);
+        ASSERT_EQ(out[4], ~uint256{0});
+
+        auto const signed_lhs = make_values<int512>(11, 3);
+        auto const signed_rhs = make_values<int512>(11, 4);
+        auto signed_out = std::vector<int512>(11);
+        bigint::add_n(std::span{signed_out}, signed_lhs, signed_rhs);
+        for (auto i = 0uz; i < signed_out.size(); ++i) {
+            ASSERT_EQ(signed_out[i], signed_lhs[i] + signed_rhs[i]);
+        }
+        ASSERT_THROW(bigint::add_n(std::span{signed_out}, signed_lhs, std::span{signed_rhs}.first(3)),
+                     std::invalid_argument);
+    }
+
+    TEST(bigint23, mul_n_test) {
+        auto const lhs = make_values<int512>(9, 5);
+        auto const rhs = make_values<int512>(9, 6);
+        auto out = std::vector<int512>(9);
+        bigint::mul_n(std::span{out}, lhs, rhs);
+        for (auto i = 0uz; i < out.size(); ++i) {
+            ASSERT_EQ(out[i], lhs[i] * rhs[i]);
+        }
+    }
+
+    TEST(bigint23, compare_n_test) {
+        auto const lhs = make_values<int512>(21, 7);
+        auto rhs = make_values<int512>(21, 8);
+        rhs[0] = lhs[0];
+        rhs[1] = lhs[1] + 1;
+        rhs[2] = lhs[2] - 1;
+        auto out = std::vector<std::strong_ordering>(21, std::strong_ordering::equal);
+        bigint::compare_n(std::span{out}, std::span<int512 const>{lhs}, rhs);
+        for (auto i = 0uz; i < out.size(); ++i) {
+            ASSERT_EQ(out[i], lhs[i] <=> rhs[i]);
+        }
+        ASSERT_EQ(out[0], std::strong_ordering::equal);
+
+        auto const unsigned_lhs = make_values<uint256>(13, 9);
+        auto const unsigned_rhs = make_values<uint256>(13, 10);
+        auto unsigned_out = std::vector<std::strong_ordering>(13, std::strong_ordering::equal);
+        bigint::compare_n(std::span{unsigned_out}, std::span<uint256 const>{unsigned_lhs}, unsigned_rhs);
+        for (auto i = 0uz; i < unsigned_out.size(); ++i) {
+            ASSERT_EQ(unsigned_out[i], unsigned_lhs[i] <=> unsigned_rhs[i]);
+        }
+    }
+
+    TEST(bigint23, sum_reduce_test) {
+        auto const values = make_values<uint256>(1001, 11);
+        auto expected = uint256{};
+        for (auto const &value: values) {
+            expected += value;
+        }
+        ASSERT_EQ(bigint::sum_reduce(std::span<uint256 const>{values}), expected);
+
+        auto const narrow = std::vector<int72>{int72{-1}, int72{-1}, int72{5}, int72{1} << 71};
+        ASSERT_EQ(bigint::sum_reduce(std::span<int72 const>{narrow}), (int72{1} << 71) + 3);
+        ASSERT_EQ(bigint::sum_reduce(std::span<int72 const>{}), 0);
+    }
+
+    TEST(bigint23, constexpr_batch_test) {
+        constexpr auto sum = [] {
+            auto const values = std::array{uint256{~0ull}, uint256{1}, uint256{~uint256{0}}};
+            auto out = std::array<uint256, 3>{};
+            bigint::add_n(std::span<uint256>{out}, values, values);
+            return bigint::sum_reduce(std::span<uint256 const>{out});
+        }();
+        static_assert(sum == (uint256{1} << 65) - 2);
+        ASSERT_EQ(sum, (uint256{1} << 65) - 2);
+    }
+}
@@ -0,0 +1,146 @@
+#include <bigint23/bigint.hpp>
+#include <gtest/gtest.h>
+#include <array>
+#include <string>
+#include <string_view>
+
+namespace {
+    using int128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed>;
+    using uint128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned>;
+    using int72 = bigint::bigint<bigint::BitWidth{72}, bigint::Signedness::Signed>;
+    using uint256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+    using uint8192 = bigint::bigint<bigint::BitWidth{8192}, bigint::Signedness::Unsigned>;
+
+    template<typename T>
+    std::string_view format(std::array<char, 512> &buffer, T const &value, int const base = 10) {
+        auto const [ptr, ec] = to_chars(buffer.data(), buffer.data() + buffer.size(), value, base);
+        EXPECT_EQ(ec, std::errc{});
+        return {buffer.data(), static_cast<std::size_t>(ptr - buffer.data())};
+    }
+
+    TEST(bigint23, to_chars_bases_test) {
+        auto buffer = std::array<char, 512>{};
+        uint256 const a = "115792089237316195423570985008687907853269984665640564039457584007913129639935";
+        ASSERT_EQ(format(buffer, a, 16), "ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff");
+        ASSERT_EQ(format(buffer, a, 10), "115792089237316195423570985008687907853269984665640564039457584007913129639935");
+        ASSERT_EQ(format(buffer, a, 2), std::string(256, '1'));
+        ASSERT_EQ(format(buffer, a, 36), "6dp5qcb22im238nr3wvp0ic7q99w035jmy2iw7i6n43d37jtof");
+
+        uint128 const b = 0xfedcba9876543210ull;
+        ASSERT_EQ(format(buffer, b, 8), "1773345651416625031020");
+        ASSERT_EQ(format(buffer, b, 32), "ftn5qj1r58cgg");
+        ASSERT_EQ(format(buffer, b, 7), "44610461533514322554622");
+        ASSERT_EQ(format(buffer, uint128{0}, 5), "0");
+    }
+
+    TEST(bigint23, to_chars_negative_test) {
+        auto buffer = std::array<char, 512>{};
+        ASSERT_EQ(format(buffer, int128{-255}, 16), "-ff");
+        ASSERT_EQ(format(buffer, int72{-1}, 3), "-1");
+        int128 const minimum = int128{1} << 127;
+        ASSERT_EQ(format(buffer, minimum), "-170141183460469231731687303715884105728");
+        ASSERT_EQ(format(buffer, minimum, 2), "-1" + std::string(127, '0'));
+    }
+
+    TEST(bigint23, to_chars_too_small_test) {
+        auto buffer = std::array<char, 4>{};
+        auto const [ptr, ec] = to_chars(buffer.data(), buffer.data() + buffer.size(), int128{-12345});
+        ASSERT_EQ(ec, std::errc::value_too_large);
+        ASSERT_EQ(ptr, buffer.data() + buffer.size());
+
+        auto const exact = to_chars(buffer.data(), buffer.data() + buffer.size(), uint128{1234});
+        ASSERT_EQ(exact.ec, std::errc{});
+        ASSERT_EQ(std::string_view(buffer.data(), 4), "1234");
+
+        auto const hex = to_chars(buffer.data(), buffer.data() + 2, uint128{0x123}, 16);
+        ASSERT_EQ(hex.ec, std::errc::value_too_large);
+        auto const base = to_chars(buffer.data(), buffer.data() + buffer.size(), uint128{1}, 37);
+        ASSERT_EQ(base.ec, std::errc::invalid_argument);
+    }
+
+    TEST(bigint23, from_chars_test) {
+        constexpr auto input = std::string_view{"-7fffFFFFffffffffffffffffffffffffg"};
+        auto value = int128{};
+        auto const [ptr, ec] = from_chars(input.data(), input.data() + input.size(), value, 16);
+        ASSERT_EQ(ec, std::errc{});
+        ASSERT_EQ(ptr, input.data() + input.size() - 1);
+        ASSERT_EQ(value, -(int128{1} << 126) * 2 + 1);
+
+        constexpr auto decimal = std::string_view{"340282366920938463463374607431768211455 rest"};
+        auto unsigned_value = uint128{};
+        auto const result = from_chars(decimal.data(), decimal.data() + decimal.size(), unsigned_value);
+        ASSERT_EQ(result.ec, std::errc{});
+        ASSERT_EQ(std::string_view(result.ptr), " rest");
+        ASSERT_EQ(unsigned_value, ~uint128{0});
+
+        constexpr auto base36 = std::string_view{"Zz"};
+        auto small = int72{};
+        ASSERT_EQ(from_chars(base36.data(), base36.data() + base36.size(), small, 36).ec, std::errc{});
+        ASSERT_EQ(small, 1295);
+    }
+
+    TEST(bigint23, from_chars_errors_test) {
+        auto value = int128{42};
+        constexpr auto empty = std::string_view{"-"};
+        auto const [ptr, ec] = from_chars(empty.data(), empty.data() + empty.size(), value);
+        ASSERT_EQ(ec, std::errc::invalid_argument);
+        ASSERT_EQ(ptr, empty.data());
+        ASSERT_EQ(value, 42);
+
+        auto unsigned_value = uint128{42};
+        constexpr auto negative = std::string_view{"-1"};
+        ASSERT_EQ(from_chars(negative.data(), negative.data() + negative.size(), unsigned_value).ec,
+                  std::errc::invalid_argument);
+
+        constexpr auto too_large = std::string_view{"170141183460469231731687303715884105728;"};
+        auto const overflow = from_chars(too_large.data(), too_large.data() + too_large.size(), value);
+        ASSERT_EQ(overflow.ec, std::errc::result_out_of_range);
+        ASSERT_EQ(*overflow.ptr, ';');
+        ASSERT_EQ(value, 42);
+
+        constexpr auto minimum = std::string_view{"-170141183460469231731687303715884105728"};
+        ASSERT_EQ(from_chars(minimum.data(), minimum.data() + minimum.size(), value).ec, std::errc{});
+        ASSERT_EQ(value, int128{1} << 127);
+
+        auto narrow = int72{};
+        constexpr auto wide = std::string_view{"1000000000000000000"};
+        ASSERT_EQ(from_chars(wide.data(), wide.data() + wide.size(), narrow, 16).ec, std::errc::result_out_of_range);
+    }
+
+    TEST(bigint23, radix_tables_test) {
+        using namespace bigint::detail;
+        static_assert(powers_of_ten[19] == decimal_chunk);
+        static_assert(radix_chunks[10].divisor == decimal_chunk and radix_chunks[10].digits == 19);
+        static_assert(radix_chunks[3].digits == 40 and radix_chunks[36].digits == 12);
+        static_assert(radix_chunks[16].reciprocal.shift == 3 and radix_chunks[7].reciprocal.shift == 2);
+
+        // Digits at the chunk boundaries, where the reciprocal division has to correct its estimate.
+        auto buffer = std::array<char, 512>{};
+        auto const chunk = uint256{decimal_chunk};
+        ASSERT_EQ(format(buffer, chunk * chunk - 1), std::string(38, '9'));
+        ASSERT_EQ(format(buffer, chunk * chunk), "1" + std::string(38, '0'));
+        ASSERT_EQ(format(buffer, uint256{radix_chunks[3].divisor} - 1, 3), std::string(40, '2'));
+        ASSERT_EQ(format(buffer, ~uint256{0}, 35), "pcyyh26dx4rlcw17xq2fjnau1i9jl90hs95vfptvha2f7lv37f");
+
+        // Wide enough for the divide and conquer output with the compile time powers of ten.
+        auto const wide = (uint8192{1} << 8000) - 1;
+        auto text = std::string(2600, ' ');
+        auto const written = to_chars(text.data(), text.data() + text.size(), wide, 10);
+        ASSERT_EQ(written.ec, std::errc{});
+        auto parsed = uint8192{};
+        ASSERT_EQ(from_chars(text.data(), written.ptr, parsed).ec, std::errc{});
+        ASSERT_EQ(parsed, wide);
+        ASSERT_EQ(std::string_view(text.data(), 4), "1737");
+    }
+
+    TEST(bigint23, constexpr_charconv_test) {
+        constexpr auto round_trip = [] {
+            auto buffer = std::array<char, 64>{};
+            auto const written = to_chars(buffer.data(), buffer.data() + buffer.size(), int128{-123456789}, 7);
+            auto value = int128{};
+            from_chars(buffer.data(), written.ptr, value, 7);
+            return value;
+        }();
+        static_assert(round_trip == -123456789);
+    }
+}
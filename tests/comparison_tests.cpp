@@ -52,7 +52,7 @@ namespace {
         uint128_t const b = static_cast<uint64_t>(0x43);
         ASSERT_LT(a, b);
         ASSERT_GT(b, a);
-        int128_t const c = static_cast<int64_t>(0xD6);
+        int128_t const c = static_cast<int8_t>(0xD6);
         ASSERT_GT(a, c);
         ASSERT_LT(c, a);
         int128_t const d = static_cast<int64_t>(0xD7);
@@ -0,0 +1,84 @@
+#include <bigint23/bigint.hpp>
+#include <gtest/gtest.h>
+
+namespace {
+    using int128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed>;
+    using uint256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+    using int72 = bigint::bigint<bigint::BitWidth{72}, bigint::Signedness::Signed>;
+    using ct_int128 = bigint::ct_bigint<bigint::BitWidth{128}, bigint::Signedness::Signed>;
+    using ct_uint256 = bigint::ct_bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+    using ct_int72 = bigint::ct_bigint<bigint::BitWidth{72}, bigint::Signedness::Signed>;
+
+    TEST(bigint23, ct_compare_test) {
+        ct_int128 const a = -5;
+        ct_int128 const b = 3;
+        ASSERT_TRUE(a < b);
+        ASSERT_TRUE(b > a);
+        ASSERT_TRUE(a == ct_int128{-5});
+        ASSERT_TRUE(a != b);
+        ASSERT_EQ(ct_int128{int128{1} << 127} <=> a, std::strong_ordering::less);
+
+        ct_uint256 const large = ~uint256{0};
+        ASSERT_TRUE(large > ct_uint256{uint256{1} << 255});
+        ASSERT_EQ(ct_int72{-1} <=> ct_int72{-1}, std::strong_ordering::equal);
+        ASSERT_TRUE(ct_int72{int72{1} << 71} < ct_int72{-1});
+    }
+
+    TEST(bigint23, ct_select_and_swap_test) {
+        ct_uint256 a = uint256{"0x123456789abcdef0123456789abcdef"};
+        ct_uint256 b = 42;
+        ASSERT_EQ(ct_uint256::select(true, a, b), a);
+        ASSERT_EQ(ct_uint256::select(false, a, b), b);
+
+        conditional_swap(false, a, b);
+        ASSERT_EQ(b, 42);
+        conditional_swap(true, a, b);
+        ASSERT_EQ(a, 42);
+        ASSERT_EQ(b.value(), uint256{"0x123456789abcdef0123456789abcdef"});
+    }
+
+    TEST(bigint23, ct_arithmetic_test) {
+        uint256 const a = "0xfedcba9876543210fedcba9876543210fedcba9876543210";
+        uint256 const b = "0x123456789abcdef0123456789";
+        ct_uint256 const x = a;
+        ct_uint256 const y = b;
+        ASSERT_EQ((x + y).value(), a + b);
+        ASSERT_EQ((y - x).value(), b - a);
+        ASSERT_EQ((x * y).value(), a * b);
+        ASSERT_EQ((x * x).value(), a * a);
+        ASSERT_EQ((x / y).value(), a / b);
+        ASSERT_EQ((x % y).value(), a % b);
+        ASSERT_EQ((x >> 100).value(), a >> 100);
+        ASSERT_EQ((-ct_int72{-7} * 3).value(), 21);
+
+        auto z = x;
+        z += 1;
+        z *= y;
+        z -= y;
+        ASSERT_EQ(z.value(), a * b);
+        ASSERT_THROW(std::ignore = x / ct_uint256{}, std::overflow_error);
+    }
+
+    TEST(bigint23, ct_signed_division_test) {
+        ASSERT_EQ(ct_int128{-7} / 2, -3);
+        ASSERT_EQ(ct_int128{-7} % 2, -1);
+        ASSERT_EQ(ct_int128{7} / -2, -3);
+        ASSERT_EQ(ct_int128{7} % -2, 1);
+        ASSERT_EQ(ct_int72{-1000} >> 3, -125);
+
+        // Negating or dividing the minimum value wraps instead of throwing.
+        ct_int128 const minimum = int128{1} << 127;
+        ASSERT_EQ(-minimum, minimum);
+        ASSERT_EQ(minimum / -1, minimum);
+        ASSERT_EQ(minimum % -1, 0);
+        ASSERT_EQ(minimum / ct_int128{int128{1} << 126}, -2);
+    }
+
+    TEST(bigint23, constexpr_ct_test) {
+        constexpr auto quotient = ct_int128{-1000000007} / ct_int128{1000};
+        static_assert(quotient == -1000000);
+        static_assert(ct_int128{-3} < ct_int128{2});
+        static_assert((ct_uint256{uint256{1} << 200} * ct_uint256{uint256{1} << 55}).value() == uint256{1} << 255);
+        ASSERT_EQ(quotient.value(), -1000000);
+    }
+}
@@ -94,4 +94,39 @@ namespace {
         constexpr auto c = a >> 3;
         ASSERT_EQ(c, 0b0001);
     }
+
+    TEST(bigint23, constexpr_carry_chain_test) {
+        using u256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+        constexpr u256 a("0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff");
+        constexpr auto sum = a + 1;
+        constexpr auto difference = sum - 1;
+        static_assert(sum == 0);
+        static_assert(difference == a);
+        auto runtime = a;
+        runtime += 1;
+        ASSERT_EQ(runtime, sum);
+        runtime -= 1;
+        ASSERT_EQ(runtime, difference);
+    }
+
+    TEST(bigint23, constexpr_multi_limb_division_test) {
+        using u256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+        constexpr u256 a("0x123456789abcdef0123456789abcdef0123456789abcdef");
+        constexpr u256 b("0xfedcba9876543210fedcba98");
+        constexpr auto quotient = a / b;
+        constexpr auto remainder = a % b;
+        static_assert(quotient * b + remainder == a);
+        static_assert(remainder < b);
+        ASSERT_EQ(a / b, quotient);
+        ASSERT_EQ(a % b, remainder);
+    }
+
+    TEST(bigint23, constexpr_wide_multiply_test) {
+        using u128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned>;
+        constexpr u128 a("0xfedcba9876543210fedcba9876543210");
+        constexpr auto product = bigint::wide_multiply(a, a);
+        constexpr auto high = bigint::mul_hi(a, a);
+        static_assert(product == (decltype(product){high} << 128) + a * a);
+        ASSERT_EQ(bigint::mul_hi(a, a), high);
+    }
 }
@@ -0,0 +1,71 @@
+#include <bigint23/dispatch.hpp>
+#include <gtest/gtest.h>
+#include "test_values.hpp"
+#include <vector>
+
+namespace {
+    using test_values::make_values;
+    using uint256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+    using int512 = bigint::bigint<bigint::BitWidth{512}, bigint::Signedness::Signed>;
+    using int72 = bigint::bigint<bigint::BitWidth{72}, bigint::Signedness::Signed>;
+    using uint1088 = bigint::bigint<bigint::BitWidth{1088}, bigint::Signedness::Unsigned>;
+
+    template<typename T>
+    void expect_operators(std::uint64_t const seed) {
+        auto const lhs = make_values<T>(50, seed);
+        auto const rhs = make_values<T>(50, seed + 1);
+        for (auto i = 0uz; i < lhs.size(); ++i) {
+            ASSERT_EQ(bigint::dispatch::add(lhs[i], rhs[i]), lhs[i] + rhs[i]);
+            ASSERT_EQ(bigint::dispatch::subtract(lhs[i], rhs[i]), lhs[i] - rhs[i]);
+            ASSERT_EQ(bigint::dispatch::multiply(lhs[i], rhs[i]), lhs[i] * rhs[i]);
+            ASSERT_EQ(bigint::dispatch::wide_multiply(lhs[i], rhs[i]), bigint::wide_multiply(lhs[i], rhs[i]));
+        }
+    }
+
+    TEST(bigint23, dispatch_selection_test) {
+        auto const [arithmetic, batch] = bigint::dispatch::selected();
+        ASSERT_TRUE(arithmetic == bigint::dispatch::variant::generic or arithmetic == bigint::dispatch::variant::bmi2_adx);
+        ASSERT_NE(batch, bigint::dispatch::variant::bmi2_adx);
+        ASSERT_EQ(bigint::dispatch::selected().arithmetic, arithmetic);
+        ASSERT_EQ(bigint::dispatch::to_string(bigint::dispatch::variant::bmi2_adx), "bmi2_adx");
+        ASSERT_EQ(bigint::dispatch::to_string(bigint::dispatch::variant::avx512), "avx512");
+    }
+
+    TEST(bigint23, dispatch_arithmetic_test) {
+        expect_operators<uint256>(1);
+        expect_operators<int512>(3);
+        expect_operators<int72>(5);
+        expect_operators<uint1088>(7);
+
+        auto const minimum = int512{1} << 511;
+        ASSERT_EQ(bigint::dispatch::wide_multiply(minimum, minimum), bigint::wide_multiply(minimum, minimum));
+        ASSERT_EQ(bigint::dispatch::add(~uint256{0}, uint256{1}), 0);
+        ASSERT_EQ(bigint::dispatch::subtract(uint256{0}, uint256{1}), ~uint256{0});
+    }
+
+    TEST(bigint23, dispatch_limbs_test) {
+        auto const lhs = std::vector<std::uint64_t>(7, ~0ull);
+        auto const rhs = std::vector<std::uint64_t>{1, 0, 0, 0, 0, 0, 0};
+        auto out = std::vector<std::uint64_t>(7);
+        ASSERT_EQ(bigint::dispatch::add_limbs(out.data(), lhs.data(), rhs.data(), 7), 1);
+        ASSERT_EQ(out, std::vector<std::uint64_t>(7, 0));
+        ASSERT_EQ(bigint::dispatch::sub_limbs(out.data(), rhs.data(), lhs.data(), 7), 1);
+        ASSERT_EQ(out, (std::vector<std::uint64_t>{2, 0, 0, 0, 0, 0, 0}));
+
+        // (2^448 - 1) * (2^64 - 1) = 2^512 - 2^448 - 2^64 + 1
+        auto product = std::vector<std::uint64_t>(8);
+        bigint::dispatch::mul_limbs(product.data(), lhs.data(), 7, lhs.data(), 1);
+        ASSERT_EQ(product, (std::vector<std::uint64_t>{1, ~0ull, ~0ull, ~0ull, ~0ull, ~0ull, ~0ull, ~0ull - 1}));
+    }
+
+    TEST(bigint23, dispatch_mul_n_test) {
+        auto const lhs = make_values<int512>(9, 11);
+        auto const rhs = make_values<int512>(9, 12);
+        auto out = std::vector<int512>(9);
+        bigint::dispatch::mul_n(std::span{out}, lhs, rhs);
+        for (auto i = 0uz; i < out.size(); ++i) {
+            ASSERT_EQ(out[i], lhs[i] * rhs[i]);
+        }
+        ASSERT_THROW(bigint::dispatch::mul_n(std::span{out}, lhs, std::span{rhs}.first(3)), std::invalid_argument);
+    }
+}
@@ -0,0 +1,171 @@
+// A dudect-style timing leak test (Reparaz, Balasch, Verbauwhede: "Dude, is my code constant
+// time?"). Each operation is timed on two input classes, a fixed operand and random operands,
+// in random order. Welch's t-test then compares the two timing distributions, once on all
+// samples and once on samples below a few percentiles to cut off interrupts and other outliers.
+// |t| above the threshold is strong evidence of a leak.
+//
+// Usage: bigint_timing_leak [measurements]. Exits with 1 if any ct_bigint operation leaks. The
+// plain bigint operations are printed for comparison only and are expected to leak.
+
+#include <bigint23/bigint.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace {
+    using uint256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+    using ct_uint256 = bigint::ct_bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+
+    constexpr auto leak_threshold = 10.0;
+    constexpr auto percentiles = std::array{1.0, 0.9, 0.5};
+
+    std::uint64_t timestamp() {
+#if defined(__x86_64__) || defined(_M_X64)
+        return __rdtsc();
+#else
+        return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    // Welford's online mean and variance for one input class.
+    struct moments {
+        double count = 0;
+        double mean = 0;
+        double m2 = 0;
+
+        void push(double const value) {
+            count += 1;
+            auto const delta = value - mean;
+            mean += delta / count;
+            m2 += delta * (value - mean);
+        }
+
+        [[nodiscard]] double variance() const {
+            return count > 1 ? m2 / (count - 1) : 0;
+        }
+    };
+
+    [[nodiscard]] double welch_t(moments const &fixed, moments const &random) {
+        auto const error = std::sqrt(fixed.variance() / fixed.count + random.variance() / random.count);
+        return error == 0 ? 0 : (fixed.mean - random.mean) / error;
+    }
+
+    struct sample {
+        bool random_class;
+        double cycles;
+    };
+
+    // Returns the largest |t| over the cropped sample sets.
+    double analyze(std::vector<sample> const &samples) {
+        auto cycles = std::vector<double>{};
+        for (auto const &[random_class, value]: samples) {
+            cycles.push_back(value);
+        }
+        std::ranges::sort(cycles);
+
+        auto result = 0.0;
+        for (auto const percentile: percentiles) {
+            auto const index = static_cast<std::size_t>(percentile * static_cast<double>(cycles.size() - 1));
+            auto const cutoff = cycles[index];
+            auto fixed = moments{};
+            auto random = moments{};
+            for (auto const &[random_class, value]: samples) {
+                if (value <= cutoff) {
+                    (random_class ? random : fixed).push(value);
+                }
+            }
+            result = std::max(result, std::abs(welch_t(fixed, random)));
+        }
+        return result;
+    }
+
+    uint256 random_value(std::mt19937_64 &engine) {
+        auto result = uint256{};
+        for (auto i = 0; i < 4; ++i) {
+            result = (result << 64) | uint256{engine()};
+        }
+        return result;
+    }
+
+    // Times operation(fixed class or random class operand, second operand) over the given number
+    // of measurements. The second operand is random for both classes. All inputs are prepared up
+    // front so that only the operation itself runs between the two timestamps.
+    template<typename T>
+    double measure(std::size_t const measurements, T const &fixed,
+                   std::function<T(T const &, T const &)> const &operation) {
+        auto engine = std::mt19937_64{0x5eed};
+        auto classes = std::vector<bool>(measurements);
+        auto lhs = std::vector<T>(measurements);
+        auto rhs = std::vector<T>(measurements);
+        for (auto i = 0uz; i < measurements; ++i) {
+            classes[i] = (engine() & 1) != 0;
+            lhs[i] = classes[i] ? T{random_value(engine)} : fixed;
+            rhs[i] = T{random_value(engine) >> 1} + 1;
+        }
+
+        auto samples = std::vector<sample>{};
+        samples.reserve(measurements);
+        for (auto i = 0uz; i < measurements; ++i) {
+            auto const start = timestamp();
+            auto volatile sink = operation(lhs[i], rhs[i]);
+            auto const stop = timestamp();
+            static_cast<void>(sink);
+            samples.push_back({classes[i], static_cast<double>(stop - start)});
+        }
+        return analyze(samples);
+    }
+
+    template<typename T>
+    bool report(std::string_view const name, std::size_t const measurements, T const &fixed,
+                std::function<T(T const &, T const &)> const &operation, bool const expect_constant) {
+        auto const t = measure(measurements, fixed, operation);
+        auto const leaks = t > leak_threshold;
+        std::cout << name << ": max |t| = " << t << (leaks ? " (leak)" : "") << '\n';
+        return not expect_constant or not leaks;
+    }
+}
+
+int main(int argc, char **argv) {
+    auto const measurements = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000ull;
+    auto passed = true;
+
+    auto const ct_zero = ct_uint256{};
+    passed &= report<ct_uint256>("ct_bigint compare", measurements, ct_zero, [](auto const &lhs, auto const &rhs) {
+        return ct_uint256::select(lhs < rhs, lhs, rhs);
+    }, true);
+    passed &= report<ct_uint256>("ct_bigint equal", measurements, ct_zero, [](auto const &lhs, auto const &rhs) {
+        return ct_uint256::select(lhs == rhs, lhs, rhs);
+    }, true);
+    passed &= report<ct_uint256>("ct_bigint add", measurements, ct_zero, std::plus{}, true);
+    passed &= report<ct_uint256>("ct_bigint subtract", measurements, ct_zero, std::minus{}, true);
+    passed &= report<ct_uint256>("ct_bigint multiply", measurements, ct_zero, std::multiplies{}, true);
+    passed &= report<ct_uint256>("ct_bigint divide", measurements, ct_zero, std::divides{}, true);
+    passed &= report<ct_uint256>("ct_bigint modulo", measurements, ct_zero, std::modulus{}, true);
+    passed &= report<ct_uint256>("ct_bigint swap", measurements, ct_zero, [](auto lhs, auto rhs) {
+        conditional_swap(lhs < rhs, lhs, rhs);
+        return lhs;
+    }, true);
+
+    auto const zero = uint256{};
+    report<uint256>("bigint multiply (reference)", measurements, zero, std::multiplies{}, false);
+    report<uint256>("bigint divide (reference)", measurements, zero, std::divides{}, false);
+
+    std::cout << (passed ? "No leak detected." : "Timing leak detected.") << '\n';
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
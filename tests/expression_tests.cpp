@@ -0,0 +1,60 @@
+#include <bigint23/expression.hpp>
+#include <gtest/gtest.h>
+#include "test_values.hpp"
+
+namespace {
+    using test_values::random_value;
+    using int4096 = bigint::bigint<bigint::BitWidth{4096}, bigint::Signedness::Signed>;
+    using uint256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+    using int72 = bigint::bigint<bigint::BitWidth{72}, bigint::Signedness::Signed>;
+
+    TEST(bigint23, fma_test) {
+        auto const a = random_value<uint256>(1, 4);
+        auto const b = random_value<uint256>(2, 3);
+        auto const c = random_value<uint256>(3, 4);
+        ASSERT_EQ(fma(a, b, c), a * b + c);
+
+        auto accumulator = c;
+        ASSERT_EQ(mul_add(accumulator, a, b), a * b + c);
+        ASSERT_EQ(mul_sub(accumulator, a, b), c);
+        ASSERT_EQ(mul_sub(accumulator, a, a), c - a * a);
+
+        // Wide operands go through the fast multiplication, narrow ones are added row by row.
+        auto const d = -random_value<int4096>(4, 64);
+        auto const e = random_value<int4096>(5, 40);
+        auto const f = random_value<int4096>(6, 3);
+        ASSERT_EQ(fma(d, e, f), d * e + f);
+        ASSERT_EQ(fma(d, f, e), d * f + e);
+        auto wide = e;
+        ASSERT_EQ(mul_sub(wide, f, d), e - f * d);
+
+        auto const g = int72{-5};
+        ASSERT_EQ(fma(g, int72{7}, int72{3}), -32);
+        static_assert(fma(uint256{3}, uint256{4}, uint256{5}) == 17);
+    }
+
+    TEST(bigint23, expression_test) {
+        using bigint::expression::lazy;
+        auto const a = random_value<int4096>(7, 64);
+        auto const b = -random_value<int4096>(8, 20);
+        auto const c = random_value<int4096>(9, 50);
+        auto const d = random_value<int4096>(10, 2);
+        auto const e = random_value<int4096>(11, 64);
+
+        int4096 const fused = lazy(a) * b + lazy(c) * d - e;
+        ASSERT_EQ(fused, a * b + c * d - e);
+        ASSERT_EQ(int4096{e - lazy(a) * b}, e - a * b);
+        ASSERT_EQ(int4096{-(lazy(a) * b) + c}, c - a * b);
+        ASSERT_EQ(int4096{(lazy(a) + b) * (lazy(c) - d)}, (a + b) * (c - d));
+        ASSERT_EQ(int4096{lazy(a) * b * c}, a * b * c);
+        ASSERT_EQ(bigint::expression::evaluate(lazy(d) - d), 0);
+        ASSERT_EQ(bigint::expression::evaluate(e), e);
+
+        constexpr auto compile_time = [] {
+            auto const x = uint256{1} << 200;
+            auto const y = uint256{12345};
+            return uint256{lazy(x) * y - lazy(y) * y + x};
+        }();
+        static_assert(compile_time == (uint256{1} << 200) * 12346 - uint256{12345} * 12345);
+    }
+}
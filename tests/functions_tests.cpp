@@ -4,6 +4,7 @@
 
 #include <bigint23/bigint.hpp>
 #include <gtest/gtest.h>
+#include <limits>
 
 TEST(bigint23, byteswap_test) {
     bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned> const expected = "0x78563412000000000000000000000000";
@@ -24,3 +25,91 @@ TEST(bigint23, abs_test) {
     auto const actual2 = abs(expected);
     ASSERT_EQ(actual2, expected);
 }
+
+TEST(bigint23, divmod_test) {
+    using i128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed>;
+    using u256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+    u256 const a = "0x123456789abcdef0123456789abcdef0123456789abcdef";
+    u256 const b = "0xfedcba9876543210fedcba98";
+    auto const [quotient, remainder] = divmod(a, b);
+    ASSERT_EQ(quotient, a / b);
+    ASSERT_EQ(remainder, a % b);
+    auto const small = divmod(a, 10u);
+    ASSERT_EQ(small.quotient, a / 10u);
+    ASSERT_EQ(small.remainder, a % 10u);
+    i128 const c = -7;
+    auto const truncated = divmod(c, 2);
+    ASSERT_EQ(truncated.quotient, -3);
+    ASSERT_EQ(truncated.remainder, -1);
+    ASSERT_THROW(std::ignore = divmod(c, 0), std::overflow_error);
+    constexpr auto constant = divmod(i128{-7}, i128{-2});
+    static_assert(constant.quotient == 3 and constant.remainder == -1);
+
+    // An unsigned dividend divides by the two's complement of a negative divisor, like operator/.
+    using u64 = bigint::bigint<bigint::BitWidth{64}, bigint::Signedness::Unsigned>;
+    auto const u = u64{33432};
+    auto const negative = divmod(u, -7);
+    ASSERT_EQ(negative.quotient, u / -7);
+    ASSERT_EQ(negative.remainder, u % -7);
+    ASSERT_EQ(negative.quotient, 0);
+    ASSERT_EQ(negative.remainder, 33432);
+    auto const wide_negative = divmod(~a, -7);
+    ASSERT_EQ(wide_negative.quotient, ~a / -7);
+    ASSERT_EQ(wide_negative.remainder, ~a % -7);
+}
+
+TEST(bigint23, divmod_floor_test) {
+    using i128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed>;
+    using u128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned>;
+    i128 const a = -7;
+    auto const negative_dividend = divmod_floor(a, 2);
+    ASSERT_EQ(negative_dividend.quotient, -4);
+    ASSERT_EQ(negative_dividend.remainder, 1);
+    auto const negative_divisor = divmod_floor(i128{7}, i128{-2});
+    ASSERT_EQ(negative_divisor.quotient, -4);
+    ASSERT_EQ(negative_divisor.remainder, -1);
+    auto const both_negative = divmod_floor(a, -2);
+    ASSERT_EQ(both_negative.quotient, 3);
+    ASSERT_EQ(both_negative.remainder, -1);
+    auto const exact = divmod_floor(i128{-8}, 2u);
+    ASSERT_EQ(exact.quotient, -4);
+    ASSERT_EQ(exact.remainder, 0);
+    auto const unsigned_result = divmod_floor(u128{7}, 2);
+    ASSERT_EQ(unsigned_result.quotient, 3);
+    ASSERT_EQ(unsigned_result.remainder, 1);
+}
+
+TEST(bigint23, bit_functions_test) {
+    using u512 = bigint::bigint<bigint::BitWidth{512}, bigint::Signedness::Unsigned>;
+    using i72 = bigint::bigint<bigint::BitWidth{72}, bigint::Signedness::Signed>;
+    u512 const a = (u512{1} << 300) | (u512{0xf0} << 60);
+    ASSERT_EQ(popcount(a), 5);
+    ASSERT_EQ(countl_zero(a), 211);
+    ASSERT_EQ(countr_zero(a), 64);
+    ASSERT_EQ(bit_width(a), 301);
+    ASSERT_FALSE(has_single_bit(a));
+    ASSERT_TRUE(has_single_bit(u512{1} << 511));
+    ASSERT_FALSE(has_single_bit(u512{0}));
+    ASSERT_EQ(countl_zero(u512{0}), 512);
+    ASSERT_EQ(countr_zero(u512{0}), 512);
+    ASSERT_EQ(popcount(~u512{0}), 512);
+    ASSERT_EQ(countl_one(~u512{0} >> 3), 0);
+    ASSERT_EQ(countr_one(u512{0x7f}), 7);
+
+    // The width of a signed type with a partial top limb counts its two's complement bits only.
+    ASSERT_EQ(popcount(i72{-1}), 72);
+    ASSERT_EQ(countl_zero(i72{1}), 71);
+    ASSERT_EQ(countl_one(i72{-2}), 71);
+    ASSERT_EQ(bit_width(i72{255}), 8);
+
+    ASSERT_EQ(rotl(a, 212), (u512{1}) | (u512{0xf0} << 272));
+    ASSERT_EQ(rotr(a, 300), rotl(a, 212));
+    ASSERT_EQ(rotl(a, -300), rotr(a, 300));
+    ASSERT_EQ(rotl(a, 512), a);
+    ASSERT_EQ(rotr(a, 1024 + 64), a >> 64);
+    ASSERT_EQ(rotl(i72{-128}, 4), i72{-2033});
+    ASSERT_EQ(rotr(u512{1}, std::numeric_limits<int>::min()), u512{1});
+
+    static_assert(popcount(u512{0xff}) == 8 and bit_width(u512{1} << 400) == 401);
+    static_assert(rotl(u512{3} << 510, 1) == (u512{1} << 511 | u512{1}));
+}
@@ -4,6 +4,7 @@
 
 #include <bigint23/bigint.hpp>
 #include <gtest/gtest.h>
+#include <locale>
 #include <sstream>
 
 namespace {
@@ -107,4 +108,72 @@ namespace {
         iss >> a;
         ASSERT_EQ(a, 0);
     }
+
+    TEST(bigint23, decimal_multi_limb_os_test) {
+        bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Signed> const a(
+            "-57896044618658097711785492504343953926634992332820282019728792003956564819967");
+        std::ostringstream oss;
+        oss << std::dec << a << ' ' << bigint::bigint<bigint::BitWidth{32}, bigint::Signedness::Signed>(128);
+        ASSERT_EQ(oss.str(), "-57896044618658097711785492504343953926634992332820282019728792003956564819967 128");
+    }
+
+    TEST(bigint23, decimal_minimum_os_test) {
+        bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed> const a(
+            "-170141183460469231731687303715884105727");
+        std::ostringstream oss;
+        oss << std::dec << a - 1;
+        ASSERT_EQ(oss.str(), "-170141183460469231731687303715884105728");
+    }
+
+    TEST(bigint23, decimal_wide_os_test) {
+        using u4096 = bigint::bigint<bigint::BitWidth{4096}, bigint::Signedness::Unsigned>;
+        auto const expected = std::string("1") + std::string(1000, '0') + "1" + std::string(200, '0');
+        u4096 const a(expected);
+        std::ostringstream oss;
+        oss << std::dec << a;
+        ASSERT_EQ(oss.str(), expected);
+    }
+
+#if defined(__cpp_lib_format)
+    TEST(bigint23, format_base_test) {
+        bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed> const a(-255);
+        bigint::bigint<bigint::BitWidth{96}, bigint::Signedness::Unsigned> const b(0xBEEFu);
+        ASSERT_EQ(std::format("{}", a), "-255");
+        ASSERT_EQ(std::format("{:d} {:x} {:X} {:o} {:b}", b, b, b, b, b), "48879 beef BEEF 137357 1011111011101111");
+        ASSERT_EQ(std::format("{:#x} {:#X} {:#o} {:#b} {:#B}", a, b, b, b, b),
+                  "-0xff 0XBEEF 0137357 0b1011111011101111 0B1011111011101111");
+        ASSERT_EQ(std::format("{:#o}", bigint::bigint<bigint::BitWidth{64}, bigint::Signedness::Unsigned>{0u}), "0");
+    }
+
+    TEST(bigint23, format_width_test) {
+        bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed> const a(-42);
+        bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed> const b(42);
+        ASSERT_EQ(std::format("[{:8}]", a), "[     -42]");
+        ASSERT_EQ(std::format("[{:<8}]", a), "[-42     ]");
+        ASSERT_EQ(std::format("[{:*^9}]", b), "[***42****]");
+        ASSERT_EQ(std::format("[{:+08}]", b), "[+0000042]");
+        ASSERT_EQ(std::format("[{:#010x}]", a), "[-0x000002a]");
+        ASSERT_EQ(std::format("[{: }] [{:-}]", b, b), "[ 42] [42]");
+        ASSERT_EQ(std::format("[{:>+6}]", b), "[   +42]");
+    }
+
+    TEST(bigint23, format_grouping_test) {
+        struct grouping final : std::numpunct<char> {
+            [[nodiscard]] char do_thousands_sep() const override {
+                return '\'';
+            }
+
+            [[nodiscard]] std::string do_grouping() const override {
+                return "\3";
+            }
+        };
+
+        auto const locale = std::locale(std::locale::classic(), new grouping);
+        bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Signed> const a("-1234567890123456789012345");
+        ASSERT_EQ(std::format(locale, "{:L}", a), "-1'234'567'890'123'456'789'012'345");
+        ASSERT_EQ(std::format(locale, "{:Lx}", bigint::bigint<bigint::BitWidth{64}, bigint::Signedness::Unsigned>{0x123456u}),
+                  "123'456");
+        ASSERT_EQ(std::format("{:L}", a), "-1234567890123456789012345");
+    }
+#endif
 }
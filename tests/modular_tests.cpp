@@ -0,0 +1,83 @@
+#include <bigint23/bigint.hpp>
+#include <gtest/gtest.h>
+
+namespace {
+    using uint256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Unsigned>;
+    using uint72 = bigint::bigint<bigint::BitWidth{72}, bigint::Signedness::Unsigned>;
+
+    TEST(bigint23, montgomery_multiply_test) {
+        auto const modulus = (uint256{1} << 255) - 19;
+        auto const context = bigint::montgomery_context<bigint::BitWidth{256}>{modulus};
+        uint256 const a = "0x1234567890abcdef1234567890abcdef1234567890abcdef1234567890abcdef";
+        uint256 const b = modulus - 2;
+        ASSERT_EQ(context.modulus(), modulus);
+        ASSERT_EQ(context.from_mont(context.to_mont(a)), a);
+        ASSERT_EQ(context.from_mont(context.mul(context.to_mont(a), context.to_mont(b))),
+                  uint256{"0x5b97530edea86421db97530edea86421db97530edea86421db97530edea8640f"});
+        ASSERT_EQ(context.from_mont(context.sqr(context.to_mont(a))),
+                  uint256{"0x4e30f56aa3991abb06678fa27e58dbc43e9e29da59189ccd76d4c41233d85dd2"});
+        ASSERT_EQ(context.from_mont(context.sqr(context.to_mont(b))), 4);
+        ASSERT_EQ(context.from_mont(context.one()), 1);
+        ASSERT_EQ(context.to_mont(modulus + 5), context.to_mont(uint256{5}));
+    }
+
+    TEST(bigint23, montgomery_narrow_test) {
+        uint72 const modulus = "0xfffffffffffffffffd";
+        auto const context = bigint::montgomery_context<bigint::BitWidth{72}>{modulus};
+        auto const a = modulus - 1;
+        ASSERT_EQ(context.from_mont(context.mul(context.to_mont(a), context.to_mont(a))), 1);
+        ASSERT_EQ(context.from_mont(context.mul(context.to_mont(a), context.to_mont(uint72{2}))), modulus - 2);
+        ASSERT_EQ(context.from_mont(context.sqr(context.to_mont(uint72{0x1000000000}))), 3);
+    }
+
+    TEST(bigint23, montgomery_even_modulus_test) {
+        ASSERT_THROW(std::ignore = bigint::montgomery_context<bigint::BitWidth{256}>{uint256{1} << 100},
+                     std::invalid_argument);
+    }
+
+    TEST(bigint23, constexpr_montgomery_test) {
+        using uint128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned>;
+        constexpr auto context = bigint::montgomery_context<bigint::BitWidth{128}>{
+            uint128{"0xffffffffffffffffffffffffffffff61"}
+        };
+        constexpr auto value = uint128{"0x10000000000000000"};
+        constexpr auto square = context.from_mont(context.sqr(context.to_mont(value)));
+        static_assert(square == 0x9f);
+        static_assert(context.from_mont(context.mul(context.to_mont(value), context.one())) == value);
+        ASSERT_EQ(context.from_mont(context.sqr(context.to_mont(value))), square);
+    }
+
+    TEST(bigint23, pow_mod_test) {
+        auto const modulus = (uint256{1} << 255) - 19;
+        uint256 const a = "0x1234567890abcdef1234567890abcdef1234567890abcdef1234567890abcdef";
+        uint256 const inverse = "0x3f3aad64adc9f2a2dd63ddcf25c8c0ea6acdb63ba04bc5411ef637cbfefacee1";
+        for (auto const mode: {bigint::PowMode::SlidingWindow, bigint::PowMode::MontgomeryLadder}) {
+            ASSERT_EQ(pow_mod(a, modulus - 2, modulus, mode), inverse);
+            ASSERT_EQ(pow_mod(a, uint72{0x10001}, modulus, mode),
+                      uint256{"0x52f34bf450f28d6eb0286ec89c2e71bcab5ea36e6acdba27b95d3e8c0f9d5933"});
+            ASSERT_EQ(pow_mod(a, uint256{0}, modulus, mode), 1);
+            ASSERT_EQ(pow_mod(a, uint256{5}, uint256{1}, mode), 0);
+        }
+    }
+
+    TEST(bigint23, pow_mod_even_modulus_test) {
+        auto const modulus = (uint256{1} << 200) + (uint256{1} << 64);
+        uint256 const a = "0x1234567890abcdef1234567890abcdef1234567890abcdef1234567890abcdef";
+        ASSERT_EQ(pow_mod(a, uint256{12345}, modulus),
+                  uint256{"0x3c40f3737392027a8dcfb472abe098e3b3ae34371f2309de6f"});
+        ASSERT_EQ(pow_mod(a, uint256{0}, modulus), 1);
+        ASSERT_THROW(std::ignore = pow_mod(a, uint256{3}, modulus, bigint::PowMode::MontgomeryLadder),
+                     std::invalid_argument);
+        using int128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Signed>;
+        ASSERT_THROW(std::ignore = pow_mod(a, int128{-1}, modulus), std::invalid_argument);
+        ASSERT_THROW(std::ignore = pow_mod(a, uint256{3}, uint256{0}), std::overflow_error);
+    }
+
+    TEST(bigint23, constexpr_pow_mod_test) {
+        using uint128 = bigint::bigint<bigint::BitWidth{128}, bigint::Signedness::Unsigned>;
+        constexpr auto modulus = uint128{"0xffffffffffffffffffffffffffffff61"};
+        static_assert(pow_mod(uint128{3}, modulus - 1, modulus) == 1);
+        static_assert(pow_mod(uint128{7}, uint128{1000}, modulus, bigint::PowMode::MontgomeryLadder) ==
+                      uint128{"0x83932a9a30a442b41494257c9ea70b2c"});
+    }
+}
@@ -0,0 +1,85 @@
+#include <bigint23/bigint.hpp>
+#include <gtest/gtest.h>
+#include "test_values.hpp"
+#include <execution>
+#include <sstream>
+#include <string>
+
+namespace {
+    using test_values::random_value;
+    using uint65536 = bigint::bigint<bigint::BitWidth{65536}, bigint::Signedness::Unsigned>;
+    using int16384 = bigint::bigint<bigint::BitWidth{16384}, bigint::Signedness::Signed>;
+    using int256 = bigint::bigint<bigint::BitWidth{256}, bigint::Signedness::Signed>;
+
+    template<typename Policy, typename T>
+    std::string decimal_string(Policy &&policy, T const &value) {
+        auto stream = std::ostringstream{};
+        bigint::print_dec(policy, stream, value);
+        return stream.str();
+    }
+
+    TEST(bigint23, parallel_multiply_test) {
+        auto const a = random_value<uint65536>(1, 1024);
+        auto const b = random_value<uint65536>(2, 1024);
+        ASSERT_EQ(bigint::multiply(std::execution::par, a, b), a * b);
+        ASSERT_EQ(bigint::multiply(std::execution::seq, a, b), a * b);
+        ASSERT_EQ(bigint::wide_multiply(std::execution::par, a, b), bigint::wide_multiply(a, b));
+
+        auto const c = -random_value<int16384>(3, 255);
+        auto const d = random_value<int16384>(4, 200);
+        ASSERT_EQ(bigint::multiply(std::execution::par_unseq, c, d), c * d);
+        ASSERT_EQ(bigint::wide_multiply(std::execution::par, c, d), bigint::wide_multiply(c, d));
+        ASSERT_EQ(bigint::wide_multiply(std::execution::par, c, c), bigint::wide_multiply(c, c));
+
+        // Below the threshold the parallel overloads take the sequential path.
+        auto const e = int256{-12345678901234567};
+        ASSERT_EQ(bigint::multiply(std::execution::par, e, e), e * e);
+        ASSERT_EQ(bigint::wide_multiply(std::execution::par, e, int256{3}), bigint::wide_multiply(e, int256{3}));
+    }
+
+    // The overloads use one thread per hardware thread, so force forking here to cover the
+    // threaded path on machines with a single core as well.
+    TEST(bigint23, parallel_fork_test) {
+        using access = bigint::detail::limb_access;
+        constexpr auto n = std::size_t{1024};
+        auto const a = access::limbs(random_value<uint65536>(7, n));
+        auto const b = access::limbs(random_value<uint65536>(8, 1000));
+        auto const fork = bigint::detail::parallel_fork{16, 8};
+
+        auto product = std::array<bigint::detail::limb, 2 * n>{};
+        auto expected = std::array<bigint::detail::limb, 2 * n>{};
+        bigint::detail::multiply_full(a, b, product, fork);
+        bigint::detail::multiply_full(a, b, expected);
+        ASSERT_EQ(product, expected);
+
+        auto truncated = std::array<bigint::detail::limb, n>{};
+        bigint::detail::multiply(a, b, truncated, fork);
+        ASSERT_EQ(truncated, bigint::detail::slice<n>(expected));
+
+        auto text = std::string(20000, ' ');
+        auto const last = text.data() + text.size();
+        auto const first = bigint::detail::format_decimal(a, last, fork);
+        auto sequential = std::string(20000, ' ');
+        auto const sequential_first = bigint::detail::format_decimal(a, sequential.data() + sequential.size());
+        ASSERT_EQ(std::string(first, last), std::string(sequential_first, sequential.data() + sequential.size()));
+    }
+
+    TEST(bigint23, parallel_print_dec_test) {
+        auto const a = random_value<uint65536>(5, 1024);
+        auto sequential = std::ostringstream{};
+        bigint::print_dec(sequential, a);
+        ASSERT_EQ(decimal_string(std::execution::par, a), sequential.str());
+
+        // Zero limbs in the middle produce runs of zeros in the low halves.
+        auto const b = (a << 40000) | uint65536{7};
+        sequential.str({});
+        bigint::print_dec(sequential, b);
+        ASSERT_EQ(decimal_string(std::execution::par, b), sequential.str());
+
+        auto const c = -random_value<int16384>(6, 256);
+        sequential.str({});
+        bigint::print_dec(sequential, c);
+        ASSERT_EQ(decimal_string(std::execution::par, c), sequential.str());
+        ASSERT_EQ(decimal_string(std::execution::par, int16384{}), "0");
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace test_values {
+    // Values with all-ones and zero limbs so that carries run across several limbs.
+    template<typename T>
+    std::vector<T> make_values(std::size_t const count, std::uint64_t seed) {
+        auto result = std::vector<T>{};
+        for (auto i = 0uz; i < count; ++i) {
+            auto value = T{};
+            for (auto limb = 0uz; limb < sizeof(T) / sizeof(std::uint64_t); ++limb) {
+                seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+                auto const kind = seed >> 62;
+                value = (value << 64) | T{kind == 0 ? ~0ull : kind == 1 ? 0ull : seed};
+            }
+            result.push_back(value);
+        }
+        return result;
+    }
+
+    // A value of the given number of random limbs.
+    template<typename T>
+    T random_value(std::uint64_t const seed, std::size_t const limbs) {
+        auto engine = std::mt19937_64{seed};
+        auto result = T{};
+        for (auto i = 0uz; i < limbs; ++i) {
+            result = (result << 64) | T{engine()};
+        }
+        return result;
+    }
+}